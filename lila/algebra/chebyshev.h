@@ -0,0 +1,180 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <lila/arithmetic/add.h>
+#include <lila/arithmetic/dot.h>
+#include <lila/arithmetic/norm.h>
+#include <lila/arithmetic/scale.h>
+#include <lila/eigen/eigen_sym_tridiag.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/special/random.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+// Chebyshev expansion f(H) V = sum_k g_k c_k T_k(H~) V of a smooth function
+// of a Hermitian operator H, where H~ = (H - center) / halfwidth has its
+// spectrum in [-1, 1] and g_k are optional kernel damping factors. H is only
+// accessed through apply(in, out) computing out = H in, with in / out a
+// Vector or a Matrix (block of vectors).
+
+enum class ChebyshevKernel { None, Jackson, Lorentz };
+
+// Bounds [emin, emax] on the spectrum of H from a few Lanczos steps on a
+// random vector, widened by the last off-diagonal element (and 1% of the
+// width) such that the whole spectrum is enclosed
+template <class coeff_t, class apply_t>
+inline std::pair<real_t<coeff_t>, real_t<coeff_t>>
+SpectralBounds(apply_t &&apply, lila_size_t n, int steps = 20, int seed = 42) {
+  using real_type = real_t<coeff_t>;
+  assert(steps > 0);
+  normal_dist_t<coeff_t> dist(0., 1.);
+  normal_gen_t<coeff_t> gen(dist, seed);
+  auto v = Random(n, gen);
+  Normalize(v);
+  Vector<coeff_t> vold(n);
+  Vector<coeff_t> w(n);
+
+  // stop at an invariant subspace, when beta is at rounding level relative
+  // to the norm of the tridiagonal matrix (largest absolute row sum)
+  real_type eps = std::numeric_limits<real_type>::epsilon();
+  std::vector<real_type> alphas;
+  std::vector<real_type> betas;
+  real_type beta = 0.;
+  real_type tnorm = 0.;
+  for (int j = 0; j < steps; ++j) {
+    apply(v, w);
+    real_type alpha = real(Dot(v, w));
+    Add(v, w, coeff_t(-alpha));
+    if (j > 0)
+      Add(vold, w, coeff_t(-beta));
+    real_type row = std::abs(alpha) + beta;
+    beta = Norm(w);
+    tnorm = std::max(tnorm, row + beta);
+    alphas.push_back(alpha);
+    if (beta <= eps * tnorm || j == steps - 1)
+      break;
+    betas.push_back(beta);
+    swap(vold, v);
+    v = w;
+    Scale(coeff_t(1. / beta), v);
+  }
+
+  Vector<real_type> diag(alphas.size());
+  Vector<real_type> offdiag(std::max(alphas.size(), (size_t)1));
+  std::copy(alphas.begin(), alphas.end(), diag.begin());
+  std::copy(betas.begin(), betas.end(), offdiag.begin());
+  auto ritz = EigenvaluesSymTridiag(diag, offdiag);
+  real_type emin = *std::min_element(ritz.begin(), ritz.end()) - beta;
+  real_type emax = *std::max_element(ritz.begin(), ritz.end()) + beta;
+  real_type pad = 0.01 * (emax - emin);
+  return {emin - pad, emax + pad};
+}
+
+// Damping factors g_0, ..., g_{order-1} suppressing Gibbs oscillations
+template <class real_type = double>
+inline std::vector<real_type> ChebyshevKernelFactors(int order,
+                                                     ChebyshevKernel kernel,
+                                                     real_type lambda = 4.) {
+  std::vector<real_type> g(order, 1.);
+  real_type N = order;
+  if (kernel == ChebyshevKernel::Jackson) {
+    real_type q = M_PI / (N + 1);
+    for (int k = 0; k < order; ++k)
+      g[k] = ((N - k + 1) * std::cos(q * k) + std::sin(q * k) / std::tan(q)) /
+             (N + 1);
+  } else if (kernel == ChebyshevKernel::Lorentz) {
+    for (int k = 0; k < order; ++k)
+      g[k] = std::sinh(lambda * (1 - k / N)) / std::sinh(lambda);
+  }
+  return g;
+}
+
+// Coefficients c_0, ..., c_{order-1} of f on [emin, emax] from Chebyshev-
+// Gauss quadrature, f is called as f(x) for real x and returns a coeff_t
+template <class coeff_t, class function_t>
+inline std::vector<coeff_t>
+ChebyshevCoefficients(function_t f, int order, real_t<coeff_t> emin,
+                      real_t<coeff_t> emax) {
+  using real_type = real_t<coeff_t>;
+  assert(emax > emin);
+  int npoints = 2 * order;
+  real_type center = (emax + emin) / 2;
+  real_type halfwidth = (emax - emin) / 2;
+
+  std::vector<coeff_t> fvals(npoints);
+  for (int j = 0; j < npoints; ++j) {
+    real_type theta = M_PI * (j + 0.5) / npoints;
+    fvals[j] = static_cast<coeff_t>(f(center + halfwidth * std::cos(theta)));
+  }
+
+  std::vector<coeff_t> coeffs(order);
+  for (int k = 0; k < order; ++k) {
+    coeff_t c = 0.;
+    for (int j = 0; j < npoints; ++j)
+      c += fvals[j] * (real_type)std::cos(M_PI * k * (j + 0.5) / npoints);
+    coeffs[k] = c * (real_type)((k == 0 ? 1. : 2.) / npoints);
+  }
+  return coeffs;
+}
+
+// sum_k coeffs[k] T_k(H~) V by the three-term recurrence
+// T_{k+1} = 2 H~ T_k - T_{k-1}, using three rotating work vectors
+template <class coeff_t, class vec_t, class apply_t>
+inline vec_t ChebyshevApply(apply_t &&apply, std::vector<coeff_t> const &coeffs,
+                            real_t<coeff_t> emin, real_t<coeff_t> emax,
+                            vec_t const &V) {
+  assert(emax > emin);
+  coeff_t center = (emax + emin) / 2;
+  coeff_t scale = 2. / (emax - emin);
+  auto apply_scaled = [&](vec_t const &in, vec_t &out, coeff_t alpha) {
+    apply(in, out);
+    Add(in, out, -center);
+    Scale(alpha * scale, out);
+  };
+
+  vec_t res = V;
+  Scale(coeffs.empty() ? coeff_t(0.) : coeffs[0], res);
+  if (coeffs.size() < 2)
+    return res;
+
+  vec_t t0 = V;
+  vec_t t1 = V;
+  vec_t t2 = V;
+  apply_scaled(t0, t1, 1.);
+  Add(t1, res, coeffs[1]);
+  for (std::size_t k = 2; k < coeffs.size(); ++k) {
+    apply_scaled(t1, t2, 2.);
+    Add(t0, t2, coeff_t(-1.));
+    Add(t2, res, coeffs[k]);
+    swap(t0, t1);
+    swap(t1, t2);
+  }
+  return res;
+}
+
+// f(H) V on the spectral interval [emin, emax] with expansion order and
+// kernel damping
+template <class vec_t, class apply_t, class function_t>
+inline vec_t
+ChebyshevFunction(apply_t &&apply, function_t f, vec_t const &V,
+                  real_t<typename vec_t::coeff_type> emin,
+                  real_t<typename vec_t::coeff_type> emax, int order,
+                  ChebyshevKernel kernel = ChebyshevKernel::None) {
+  using coeff_t = typename vec_t::coeff_type;
+  using real_type = real_t<coeff_t>;
+  auto coeffs = ChebyshevCoefficients<coeff_t>(f, order, emin, emax);
+  auto g = ChebyshevKernelFactors<real_type>(order, kernel);
+  for (int k = 0; k < order; ++k)
+    coeffs[k] *= g[k];
+  return ChebyshevApply(apply, coeffs, emin, emax, V);
+}
+
+} // namespace lila
@@ -1,22 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+#include <lila/algebra/mult.h>
+#include <lila/arithmetic/add.h>
+#include <lila/arithmetic/norm.h>
+#include <lila/blaslapack/blaslapack.h>
 #include <lila/matrix.h>
+#include <lila/special/special.h>
 
 namespace lila {
 
-template <class coeff_t>
-inline real_t<coeff_t> NormLi(Matrix<coeff_t> const &X) {
-  real_t<coeff_t> value = 0.0;
-  for (lila_size_t i = 0; i < X.nrows(); i++) {
-    real_t<coeff_t> row_sum = 0.0;
-    for (lila_size_t j = 0; j < X.ncols(); j++) {
-      row_sum += std::abs(X(i, j));
-    }
-    value = std::max(value, row_sum);
-  }
-  return value;
-}
-
 template <class coeff_t> inline real_t<coeff_t> log2abs(coeff_t x) {
   real_t<coeff_t> value;
 
@@ -29,41 +27,228 @@ template <class coeff_t> inline real_t<coeff_t> log2abs(coeff_t x) {
   return value;
 }
 
+namespace detail {
+
+// Coefficients b_0, ..., b_m of the [m/m] Pade approximant of exp
+// (Higham, SIAM J. Matrix Anal. Appl. 26, 1179 (2005))
+constexpr double expm_pade3[] = {120., 60., 12., 1.};
+constexpr double expm_pade5[] = {30240., 15120., 3360., 420., 30., 1.};
+constexpr double expm_pade7[] = {17297280., 8648640., 1995840., 277200.,
+                                 25200.,    1512.,    56.,      1.};
+constexpr double expm_pade9[] = {17643225600., 8821612800., 2075673600.,
+                                 302702400.,   30270240.,   2162160.,
+                                 110880.,      3960.,       90.,
+                                 1.};
+constexpr double expm_pade13[] = {64764752532480000.,
+                                  32382376266240000.,
+                                  7771770303897600.,
+                                  1187353796428800.,
+                                  129060195264000.,
+                                  10559470521600.,
+                                  670442572800.,
+                                  33522128640.,
+                                  1323241920.,
+                                  40840800.,
+                                  960960.,
+                                  16380.,
+                                  182.,
+                                  1.};
+
+// Largest 1-norms for which the [m/m] approximant has backward error below
+// the unit roundoff (Higham 2005, Table 2.3 and Al-Mohy & Higham 2009)
+template <class real_type> struct expm_theta;
+template <> struct expm_theta<double> {
+  static constexpr int max_degree = 13;
+  static constexpr double theta3 = 1.495585217958292e-2;
+  static constexpr double theta5 = 2.539398330063230e-1;
+  static constexpr double theta7 = 9.504178996162932e-1;
+  static constexpr double theta9 = 2.097847961257068e0;
+  static constexpr double theta13 = 5.371920351148152e0;
+};
+template <> struct expm_theta<float> {
+  static constexpr int max_degree = 7;
+  static constexpr double theta3 = 4.258730016922831e-1;
+  static constexpr double theta5 = 1.880152677804762e0;
+  static constexpr double theta7 = 3.925724783138660e0;
+  static constexpr double theta9 = 0.;
+  static constexpr double theta13 = 0.;
+};
+
+template <class coeff_t>
+inline void expm_square(Matrix<coeff_t> const &A, Matrix<coeff_t> &C) {
+  lila_size_t n = A.nrows();
+  gemm('N', 'N', n, n, n, coeff_t(1.), A.data(), n, A.data(), n, coeff_t(0.),
+       C.data(), n);
+}
+
+template <class coeff_t>
+inline void expm_mult(Matrix<coeff_t> const &A, Matrix<coeff_t> const &B,
+                      Matrix<coeff_t> &C) {
+  lila_size_t n = A.nrows();
+  gemm('N', 'N', n, n, n, coeff_t(1.), A.data(), n, B.data(), n, coeff_t(0.),
+       C.data(), n);
+}
+
+} // namespace detail
+
+// Matrix exponential exp(alpha * A) by scaling and squaring with Pade
+// approximants of degree 3, 5, 7, 9 or 13 (Higham 2005, Al-Mohy & Higham
+// 2009). The degree and number of squarings are chosen from the 1-norms of
+// the powers A^2, A^4, A^6 which are needed for the approximant anyway, so
+// matrices of small norm only cost a few multiplications. All work matrices
+// are allocated up front, the squaring phase alternates between two buffers.
 template <class coeff_t>
 inline Matrix<coeff_t> ExpM(Matrix<coeff_t> const &A, coeff_t alpha = 1.) {
+  using real_type = real_t<coeff_t>;
+  using theta = detail::expm_theta<real_type>;
   lila_size_t n = A.nrows();
   assert(n == A.ncols());
-  const int q = 6;
-  Matrix<coeff_t> a2 = alpha * A;
-  real_t<coeff_t> a_norm = NormLi(a2);
-  int ee = (int)log2abs(a_norm) + 1;
-  int s = std::max(0, ee + 1);
-  coeff_t t = 1.0 / pow(2.0, s);
-  Scale(t, a2);
-  Matrix<coeff_t> x = a2;
-  coeff_t c = 0.5;
-  Matrix<coeff_t> e = Identity<coeff_t>(n);
-  Add(a2, e, c);
-  Matrix<coeff_t> d = Identity<coeff_t>(n);
-  Add(a2, d, -c);
-  int p = 1;
-  for (int k = 2; k <= q; k++) {
-    c = c * (coeff_t)(q - k + 1) / (coeff_t)(k * (2 * q - k + 1));
-    x = Mult(a2, x);  //SEGFAULT WHY?
-    Add(x, e, c);
-    if (p) {
-      Add(x, d, c);
+  if (n == 0)
+    return Matrix<coeff_t>();
+
+  Matrix<coeff_t> a = A;
+  if (alpha != coeff_t(1.))
+    Scale(alpha, a);
+
+  Matrix<coeff_t> a2(n, n);
+  Matrix<coeff_t> a4(n, n);
+  Matrix<coeff_t> a6(n, n);
+  Matrix<coeff_t> u(n, n);
+  Matrix<coeff_t> v(n, n);
+  Matrix<coeff_t> w(n, n);
+
+  // Upper bounds on d_k = ||A^k||_1^(1/k) from the computed powers
+  detail::expm_square(a, a2);
+  real_type n2 = Norm1(a2);
+  real_type eta = std::sqrt(n2);
+
+  int degree = 0;
+  int s = 0;
+  if (eta <= theta::theta3) {
+    degree = 3;
+  } else {
+    detail::expm_square(a2, a4);
+    real_type n4 = Norm1(a4);
+    real_type d4 = std::pow(n4, real_type(0.25));
+    real_type d6 = std::pow(n4 * n2, real_type(1. / 6.));
+    eta = std::max(d4, d6);
+    if (eta <= theta::theta5) {
+      degree = 5;
     } else {
-      Add(x, d, -c);
+      detail::expm_mult(a4, a2, a6);
+      real_type n6 = Norm1(a6);
+      d6 = std::pow(n6, real_type(1. / 6.));
+      real_type d8 = std::min(d4, std::pow(n6 * n2, real_type(0.125)));
+      real_type eta3 = std::max(d6, d8);
+      if (eta3 <= theta::theta7) {
+        degree = 7;
+      } else if ((theta::max_degree > 7) && (eta3 <= theta::theta9)) {
+        degree = 9;
+      } else if (theta::max_degree == 7) {
+        degree = 7;
+        s = std::max(0, (int)std::ceil(std::log2(eta3 / theta::theta7)));
+      } else {
+        real_type d10 = std::pow(n6 * n4, real_type(0.1));
+        real_type eta5 = std::min(eta3, std::max(d8, d10));
+        degree = 13;
+        s = std::max(0, (int)std::ceil(std::log2(eta5 / theta::theta13)));
+      }
+    }
+  }
+
+  // Scale A -> A / 2^s and its powers accordingly
+  if (s > 0) {
+    real_type sc = std::ldexp(real_type(1.), -s);
+    Scale(coeff_t(sc), a);
+    Scale(coeff_t(sc * sc), a2);
+    if (degree > 3)
+      Scale(coeff_t(std::pow(sc, 4)), a4);
+    if (degree > 5)
+      Scale(coeff_t(std::pow(sc, 6)), a6);
+  }
+
+  // Pade numerator / denominator p(A) = V + U, q(A) = V - U, where U
+  // collects the odd and V the even powers of A
+  std::fill(w.begin(), w.end(), coeff_t(0.));
+  std::fill(v.begin(), v.end(), coeff_t(0.));
+  if (degree == 13) {
+    double const *b = detail::expm_pade13;
+    Add(a6, w, coeff_t(b[13]));
+    Add(a4, w, coeff_t(b[11]));
+    Add(a2, w, coeff_t(b[9]));
+    detail::expm_mult(a6, w, u);
+    Add(a6, u, coeff_t(b[7]));
+    Add(a4, u, coeff_t(b[5]));
+    Add(a2, u, coeff_t(b[3]));
+    detail::add_identity(coeff_t(b[1]), u);
+    swap(u, w);
+    detail::expm_mult(a, w, u);
+
+    std::fill(w.begin(), w.end(), coeff_t(0.));
+    Add(a6, w, coeff_t(b[12]));
+    Add(a4, w, coeff_t(b[10]));
+    Add(a2, w, coeff_t(b[8]));
+    detail::expm_mult(a6, w, v);
+    Add(a6, v, coeff_t(b[6]));
+    Add(a4, v, coeff_t(b[4]));
+    Add(a2, v, coeff_t(b[2]));
+    detail::add_identity(coeff_t(b[0]), v);
+  } else {
+    double const *b = (degree == 3)   ? detail::expm_pade3
+                      : (degree == 5) ? detail::expm_pade5
+                      : (degree == 7) ? detail::expm_pade7
+                                      : detail::expm_pade9;
+    if (degree == 9) {
+      detail::expm_square(a4, u); // A^8
+      Add(u, w, coeff_t(b[9]));
+      Add(u, v, coeff_t(b[8]));
+    }
+    if (degree >= 7) {
+      Add(a6, w, coeff_t(b[7]));
+      Add(a6, v, coeff_t(b[6]));
+    }
+    if (degree >= 5) {
+      Add(a4, w, coeff_t(b[5]));
+      Add(a4, v, coeff_t(b[4]));
     }
-    p = !p;
+    Add(a2, w, coeff_t(b[3]));
+    Add(a2, v, coeff_t(b[2]));
+    detail::add_identity(coeff_t(b[1]), w);
+    detail::add_identity(coeff_t(b[0]), v);
+    detail::expm_mult(a, w, u);
   }
 
-  Solve(d, e);
-  for (int k = 1; k <= s; k++) {
-    e = Mult(e, e);
+  // w = V - U, u = V + U
+  {
+    coeff_t *pu = u.data();
+    coeff_t *pv = v.data();
+    coeff_t *pw = w.data();
+    lila_size_t size = n * n;
+    for (lila_size_t i = 0; i < size; ++i) {
+      pw[i] = pv[i] - pu[i];
+      pu[i] = pv[i] + pu[i];
+    }
+  }
+
+  // Solve q(A) X = p(A) via LU decomposition
+  blas_size_t bn = n;
+  blas_size_t info = 0;
+  char trans = 'N';
+  std::vector<blas_size_t> ipiv(n);
+  blaslapack::getrf(&bn, &bn, LILA_BLAS_CAST(coeff_t, w.data()), &bn,
+                    ipiv.data(), &info);
+  assert(info == 0);
+  blaslapack::getrs(&trans, &bn, &bn, LILA_BLAS_CONST_CAST(coeff_t, w.data()),
+                    &bn, ipiv.data(), LILA_BLAS_CAST(coeff_t, u.data()), &bn,
+                    &info);
+  assert(info == 0);
+
+  // Undo the scaling by repeated squaring, ping-ponging between u and w
+  for (int k = 0; k < s; ++k) {
+    detail::expm_square(u, w);
+    swap(u, w);
   }
-  return e;
+  return u;
 }
 
 } // namespace lila
@@ -0,0 +1,192 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <lila/algebra/expm.h>
+#include <lila/algebra/mult.h>
+#include <lila/arithmetic/add.h>
+#include <lila/arithmetic/scale.h>
+#include <lila/matrix.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+// Action of the matrix exponential exp(t A) V on a vector or a thin block of
+// vectors V without forming exp(t A), using the truncated Taylor series with
+// scaling of Al-Mohy & Higham, SIAM J. Sci. Comput. 33, 488 (2011). The
+// Taylor degree m and the number of steps s are chosen from the 1-norm of A
+// such that the backward error is below the unit roundoff, the series is
+// terminated early once the remaining terms are negligible.
+
+namespace detail {
+
+// theta_m for m = 5, 10, ..., 55 (Al-Mohy & Higham 2011, Table 3.1)
+template <class real_type> struct expmv_theta;
+template <> struct expmv_theta<double> {
+  static constexpr double val[] = {2.4e-3, 1.4e-1, 6.4e-1, 1.4, 2.4, 3.5,
+                                   4.7,    6.0,    7.2,    8.5, 9.9};
+};
+template <> struct expmv_theta<float> {
+  static constexpr double val[] = {1.3e-1, 1.0, 2.2, 3.6, 4.9, 6.3,
+                                   7.7,    9.1, 11., 12., 13.};
+};
+
+// Degree m and number of steps s minimizing the number of products m * s
+inline void expmv_degree(double norm, const double *theta, int &m, int &s) {
+  m = 0;
+  s = 1;
+  if (norm == 0.)
+    return;
+  double best = std::numeric_limits<double>::max();
+  for (int k = 0; k < 11; ++k) {
+    int mk = 5 * (k + 1);
+    double sk = std::max(std::ceil(norm / theta[k]), 1.);
+    if (mk * sk < best) {
+      best = mk * sk;
+      m = mk;
+      s = (int)sk;
+    }
+  }
+}
+
+template <class coeff_t>
+inline real_t<coeff_t> expmv_norm(Vector<coeff_t> const &v) {
+  real_t<coeff_t> value = 0.;
+  for (auto x : v)
+    value = std::max(value, (real_t<coeff_t>)std::abs(x));
+  return value;
+}
+
+template <class coeff_t>
+inline real_t<coeff_t> expmv_norm(Matrix<coeff_t> const &A) {
+  return NormLi(A);
+}
+
+// F = exp(t (A + mu)) F, where apply(in, out) computes out = A in and norm
+// is (an upper bound of) the 1-norm of A
+template <class coeff_t, class vec_t, class apply_t>
+inline void expmv_inplace(apply_t &&apply, real_t<coeff_t> norm, coeff_t t,
+                          coeff_t mu, vec_t &F) {
+  using real_type = real_t<coeff_t>;
+  int m, s;
+  expmv_degree(std::abs(t) * norm, expmv_theta<real_type>::val, m, s);
+  real_type tol = std::numeric_limits<real_type>::epsilon() / 2;
+  coeff_t eta = std::exp(t * mu / (real_type)s);
+
+  vec_t B = F;
+  vec_t Z = F;
+  for (int i = 0; i < s; ++i) {
+    real_type c1 = expmv_norm(B);
+    for (int j = 1; j <= m; ++j) {
+      apply(B, Z);
+      Scale(t / (coeff_t)(real_type)(s * j), Z);
+      swap(B, Z);
+      Add(B, F);
+      real_type c2 = expmv_norm(B);
+      if (c1 + c2 <= tol * expmv_norm(F))
+        break;
+      c1 = c2;
+    }
+    if (eta != coeff_t(1.))
+      Scale(eta, F);
+    B = F;
+  }
+}
+
+template <class coeff_t>
+inline void expmv_apply(Matrix<coeff_t> const &A, Vector<coeff_t> const &x,
+                        Vector<coeff_t> &y) {
+  Mult(A, x, y);
+}
+
+template <class coeff_t>
+inline void expmv_apply(Matrix<coeff_t> const &A, Matrix<coeff_t> const &X,
+                        Matrix<coeff_t> &Y) {
+  Mult(A, X, Y);
+}
+
+// A - mu with mu = trace(A) / n, which reduces the norm of A
+template <class coeff_t>
+inline Matrix<coeff_t> expmv_shift(Matrix<coeff_t> const &A, coeff_t &mu) {
+  lila_size_t n = A.nrows();
+  assert(n == A.ncols());
+  mu = 0.;
+  for (lila_size_t i = 0; i < n; ++i)
+    mu += A(i, i);
+  if (n > 0)
+    mu /= (coeff_t)(real_t<coeff_t>)n;
+  Matrix<coeff_t> As = A;
+  for (lila_size_t i = 0; i < n; ++i)
+    As(i, i) -= mu;
+  return As;
+}
+
+} // namespace detail
+
+// exp(t A) V for a dense matrix A, where V is a Vector or a Matrix whose
+// columns are propagated simultaneously
+template <class coeff_t, class vec_t>
+inline vec_t ExpMV(Matrix<coeff_t> const &A, coeff_t t, vec_t const &V) {
+  coeff_t mu;
+  auto As = detail::expmv_shift(A, mu);
+  vec_t F = V;
+  detail::expmv_inplace(
+      [&As](vec_t const &x, vec_t &y) { detail::expmv_apply(As, x, y); },
+      Norm1(As), t, mu, F);
+  return F;
+}
+
+// exp(t A) V for a matrix-free A, where apply(in, out) computes out = A in
+// and norm is (an upper bound of) the 1-norm of A
+template <class coeff_t, class vec_t, class apply_t>
+inline vec_t ExpMV(apply_t &&apply, real_t<coeff_t> norm, coeff_t t,
+                   vec_t const &V) {
+  vec_t F = V;
+  detail::expmv_inplace(apply, norm, t, coeff_t(0.), F);
+  return F;
+}
+
+// exp(t_k A) V for increasing times t_0 <= t_1 <= ..., each result is
+// obtained from the previous one by a step of length t_k - t_{k-1}
+template <class coeff_t, class vec_t>
+inline std::vector<vec_t> ExpMV(Matrix<coeff_t> const &A,
+                                std::vector<coeff_t> const &times,
+                                vec_t const &V) {
+  std::vector<vec_t> res;
+  res.reserve(times.size());
+  vec_t F = V;
+  coeff_t tprev = 0.;
+  coeff_t mu;
+  auto As = detail::expmv_shift(A, mu);
+  auto norm = Norm1(As);
+  for (coeff_t t : times) {
+    detail::expmv_inplace(
+        [&As](vec_t const &x, vec_t &y) { detail::expmv_apply(As, x, y); },
+        norm, t - tprev, mu, F);
+    res.push_back(F);
+    tprev = t;
+  }
+  return res;
+}
+
+template <class coeff_t, class vec_t, class apply_t>
+inline std::vector<vec_t> ExpMV(apply_t &&apply, real_t<coeff_t> norm,
+                                std::vector<coeff_t> const &times,
+                                vec_t const &V) {
+  std::vector<vec_t> res;
+  res.reserve(times.size());
+  vec_t F = V;
+  coeff_t tprev = 0.;
+  for (coeff_t t : times) {
+    detail::expmv_inplace(apply, norm, t - tprev, coeff_t(0.), F);
+    res.push_back(F);
+    tprev = t;
+  }
+  return res;
+}
+
+} // namespace lila
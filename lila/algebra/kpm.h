@@ -0,0 +1,185 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <lila/algebra/chebyshev.h>
+#include <lila/arithmetic/add.h>
+#include <lila/arithmetic/dot.h>
+#include <lila/arithmetic/scale.h>
+#include <lila/numeric/complex.h>
+#include <lila/special/random.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+// Kernel polynomial method (Weisse et al., Rev. Mod. Phys. 78, 275 (2006)).
+// The Chebyshev moments mu_k = <beta| T_k(H~) |alpha> of the rescaled
+// operator H~ = (H - center) / halfwidth are computed with the three-term
+// recurrence, H is only accessed through apply(in, out) computing out = H in.
+// Densities are reconstructed from kernel-damped moments by direct cosine
+// summation, no FFT is involved.
+
+namespace detail {
+
+template <class coeff_t, class apply_t>
+inline void kpm_step(apply_t &&apply, Vector<coeff_t> const &in,
+                     Vector<coeff_t> &out, coeff_t center, coeff_t scale) {
+  apply(in, out);
+  Add(in, out, -center);
+  Scale(scale, out);
+}
+
+} // namespace detail
+
+// mu_k = <alpha| T_k(H~) |alpha>, k = 0, ..., order - 1. Two moments are
+// obtained per matrix-vector product from mu_2k = 2 <t_k|t_k> - mu_0 and
+// mu_2k+1 = 2 <t_k+1|t_k> - mu_1.
+template <class coeff_t, class apply_t>
+inline std::vector<real_t<coeff_t>>
+KPMMoments(apply_t &&apply, Vector<coeff_t> const &alpha, real_t<coeff_t> emin,
+           real_t<coeff_t> emax, int order) {
+  using real_type = real_t<coeff_t>;
+  assert(emax > emin);
+  assert(order > 0);
+  coeff_t center = (emax + emin) / 2;
+  coeff_t scale = 2. / (emax - emin);
+  coeff_t two_scale = coeff_t(2.) * scale;
+
+  std::vector<real_type> mu(order, 0.);
+  auto t0 = alpha;
+  auto t1 = alpha;
+  auto t2 = alpha;
+  mu[0] = real(Dot(t0, t0));
+  if (order == 1)
+    return mu;
+  detail::kpm_step(apply, t0, t1, center, scale);
+  mu[1] = real(Dot(t0, t1));
+
+  for (int k = 1; 2 * k < order; ++k) {
+    mu[2 * k] = 2 * real(Dot(t1, t1)) - mu[0];
+    if (2 * k + 1 >= order)
+      break;
+    detail::kpm_step(apply, t1, t2, center, two_scale);
+    Add(t0, t2, coeff_t(-1.));
+    mu[2 * k + 1] = 2 * real(Dot(t2, t1)) - mu[1];
+    swap(t0, t1);
+    swap(t1, t2);
+  }
+  return mu;
+}
+
+// mu_k = <beta| T_k(H~) |alpha>, k = 0, ..., order - 1, e.g. for dynamical
+// correlation functions <psi| B^H delta(w - H) A |psi>
+template <class coeff_t, class apply_t>
+inline std::vector<coeff_t>
+KPMMoments(apply_t &&apply, Vector<coeff_t> const &alpha,
+           Vector<coeff_t> const &beta, real_t<coeff_t> emin,
+           real_t<coeff_t> emax, int order) {
+  assert(emax > emin);
+  assert(order > 0);
+  coeff_t center = (emax + emin) / 2;
+  coeff_t scale = 2. / (emax - emin);
+  coeff_t two_scale = coeff_t(2.) * scale;
+
+  std::vector<coeff_t> mu(order, 0.);
+  auto t0 = alpha;
+  auto t1 = alpha;
+  auto t2 = alpha;
+  mu[0] = Dot(beta, t0);
+  if (order == 1)
+    return mu;
+  detail::kpm_step(apply, t0, t1, center, scale);
+  mu[1] = Dot(beta, t1);
+  for (int k = 2; k < order; ++k) {
+    detail::kpm_step(apply, t1, t2, center, two_scale);
+    Add(t0, t2, coeff_t(-1.));
+    mu[k] = Dot(beta, t2);
+    swap(t0, t1);
+    swap(t1, t2);
+  }
+  return mu;
+}
+
+// Moments of the normalized density of states, Tr T_k(H~) / n, from a
+// stochastic trace over nrandom random-phase vectors (random signs for real
+// coeff_t)
+template <class coeff_t, class apply_t>
+inline std::vector<real_t<coeff_t>>
+KPMMomentsStochastic(apply_t &&apply, lila_size_t n, real_t<coeff_t> emin,
+                     real_t<coeff_t> emax, int order, int nrandom = 10,
+                     int seed = 42) {
+  using real_type = real_t<coeff_t>;
+  assert(nrandom > 0);
+  uniform_dist_t<coeff_t> dist(-1., 1.);
+  uniform_gen_t<coeff_t> gen(dist, seed);
+
+  std::vector<real_type> mu(order, 0.);
+  for (int r = 0; r < nrandom; ++r) {
+    auto v = Random(n, gen);
+    for (auto &x : v)
+      x /= std::abs(x);
+    auto mur = KPMMoments(apply, v, emin, emax, order);
+    for (int k = 0; k < order; ++k)
+      mu[k] += mur[k] / (nrandom * (real_type)n);
+  }
+  return mu;
+}
+
+// Density rho(E) = sum_k (2 - delta_k0) g_k mu_k T_k(x) / (pi sqrt(1 - x^2))
+// / halfwidth with x = (E - center) / halfwidth, on the npoints
+// Chebyshev-Gauss nodes x_j = cos(pi (j + 1/2) / npoints). Returns the pair
+// (energies, densities), energies in decreasing order.
+template <class moment_t, class real_type>
+inline std::pair<std::vector<real_type>, std::vector<moment_t>>
+KPMDensity(std::vector<moment_t> const &mu, real_type emin, real_type emax,
+           int npoints, ChebyshevKernel kernel = ChebyshevKernel::Jackson) {
+  assert(emax > emin);
+  int order = mu.size();
+  auto g = ChebyshevKernelFactors<real_type>(order, kernel);
+  real_type center = (emax + emin) / 2;
+  real_type halfwidth = (emax - emin) / 2;
+
+  std::vector<real_type> energies(npoints);
+  std::vector<moment_t> density(npoints);
+  for (int j = 0; j < npoints; ++j) {
+    real_type theta = M_PI * (j + 0.5) / npoints;
+    moment_t sum = g[0] * mu[0];
+    for (int k = 1; k < order; ++k)
+      sum += (real_type)(2 * g[k] * std::cos(k * theta)) * mu[k];
+    real_type x = std::cos(theta);
+    energies[j] = center + halfwidth * x;
+    density[j] = sum / (real_type)(M_PI * std::sin(theta) * halfwidth);
+  }
+  return {energies, density};
+}
+
+// Density rho(E) as above evaluated on an arbitrary grid of energies inside
+// (emin, emax)
+template <class moment_t, class real_type>
+inline std::vector<moment_t>
+KPMDensity(std::vector<moment_t> const &mu, real_type emin, real_type emax,
+           std::vector<real_type> const &energies,
+           ChebyshevKernel kernel = ChebyshevKernel::Jackson) {
+  assert(emax > emin);
+  int order = mu.size();
+  auto g = ChebyshevKernelFactors<real_type>(order, kernel);
+  real_type center = (emax + emin) / 2;
+  real_type halfwidth = (emax - emin) / 2;
+
+  std::vector<moment_t> density(energies.size());
+  for (std::size_t j = 0; j < energies.size(); ++j) {
+    real_type x = (energies[j] - center) / halfwidth;
+    assert(std::abs(x) < 1.);
+    real_type theta = std::acos(x);
+    moment_t sum = g[0] * mu[0];
+    for (int k = 1; k < order; ++k)
+      sum += (real_type)(2 * g[k] * std::cos(k * theta)) * mu[k];
+    density[j] = sum / (real_type)(M_PI * std::sin(theta) * halfwidth);
+  }
+  return density;
+}
+
+} // namespace lila
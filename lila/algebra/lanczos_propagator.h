@@ -0,0 +1,199 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <lila/arithmetic/add.h>
+#include <lila/arithmetic/dot.h>
+#include <lila/arithmetic/norm.h>
+#include <lila/arithmetic/scale.h>
+#include <lila/eigen/eigen_sym_tridiag.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+// Time evolution psi -> exp(z t H) psi for a Hermitian operator H which is
+// only accessible through apply(H, in, out), computing out = H in. For
+// real-time evolution z = -i (which requires a complex coeff_t), for
+// imaginary-time evolution z = -1.
+//
+// Every step builds a Krylov space of fixed dimension with the Lanczos
+// algorithm (with full reorthogonalization) and evaluates the exponential of
+// the small tridiagonal matrix through its eigendecomposition. The local
+// error is estimated by beta_0 beta_m |[exp(z dt T)]_{m,1}| (Saad 1992), and
+// the step size is adapted such that the error of every step relative to the
+// norm of psi stays below the tolerance. The Krylov basis is allocated once
+// and reused for all steps.
+template <class coeff_t> class LanczosPropagator {
+public:
+  using real_type = real_t<coeff_t>;
+
+  LanczosPropagator() = default;
+  LanczosPropagator(lila_size_t n, int krylov_dim = 30,
+                    real_type tol = 1000 *
+                                    std::numeric_limits<real_type>::epsilon())
+      : n_(n), krylov_dim_(krylov_dim), tol_(tol), basis_(krylov_dim + 1),
+        w_(n), alphas_(krylov_dim), betas_(krylov_dim),
+        coeffs_(krylov_dim) {
+    assert(krylov_dim > 0);
+    for (auto &v : basis_)
+      v.resize(n);
+  }
+
+  // Single step psi -> exp(z dt H) psi in the Krylov space spanned from psi,
+  // returns the error estimate of the step
+  template <class op_t, class apply_t>
+  real_type Step(op_t const &H, apply_t &&apply, Vector<coeff_t> &psi,
+                 coeff_t z, real_type dt) {
+    Lanczos(H, apply, psi);
+    real_type err = Coefficients(z, dt);
+    Combine(psi);
+    ++nsteps_;
+    return err;
+  }
+
+  // psi -> exp(z t H) psi with adaptive step size, returns the accumulated
+  // error estimate
+  template <class op_t, class apply_t>
+  real_type Evolve(op_t const &H, apply_t &&apply, Vector<coeff_t> &psi,
+                   coeff_t z, real_type t) {
+    assert(t >= 0);
+    real_type t_done = 0.;
+    real_type err_total = 0.;
+    if (dt_ <= 0.)
+      dt_ = t;
+
+    while (t_done < t) {
+      Lanczos(H, apply, psi);
+
+      // Retry with smaller steps on the same Krylov space until accepted
+      while (true) {
+        real_type h = std::min(dt_, t - t_done);
+        real_type err = Coefficients(z, h);
+        real_type factor =
+            (err > 0.)
+                ? real_type(0.9) * std::pow(tol_ * beta0_ / err,
+                                            real_type(1.) / (dim_ + 1))
+                : real_type(2.);
+        factor = std::min(factor, real_type(2.));
+        if ((err <= tol_ * beta0_) || (h <= min_step_ * t)) {
+          Combine(psi);
+          t_done += h;
+          err_total += err;
+          ++nsteps_;
+          if (h == dt_)
+            dt_ = h * factor;
+          break;
+        }
+        dt_ = std::max(h * factor, min_step_ * t);
+      }
+    }
+    return err_total;
+  }
+
+  lila_size_t n() const { return n_; }
+  int krylov_dim() const { return krylov_dim_; }
+  real_type tol() const { return tol_; }
+  real_type dt() const { return dt_; }
+  long nsteps() const { return nsteps_; }
+
+private:
+  lila_size_t n_ = 0;
+  int krylov_dim_ = 0;
+  real_type tol_ = 0.;
+  real_type dt_ = 0.;
+  long nsteps_ = 0;
+  static constexpr real_type min_step_ = 1e-8;
+
+  std::vector<Vector<coeff_t>> basis_;
+  Vector<coeff_t> w_;
+  Vector<real_type> alphas_;
+  Vector<real_type> betas_;
+  Vector<coeff_t> coeffs_;
+
+  // State of the last Krylov space
+  int dim_ = 0;
+  bool invariant_ = false;
+  real_type beta0_ = 0.;
+  Vector<real_type> evals_;
+  Matrix<real_type> evecs_;
+
+  template <class op_t, class apply_t>
+  void Lanczos(op_t const &H, apply_t &&apply, Vector<coeff_t> const &psi) {
+    assert(psi.size() == n_);
+    real_type eps = std::numeric_limits<real_type>::epsilon();
+
+    beta0_ = Norm(psi);
+    if (beta0_ == 0.) {
+      dim_ = 0;
+      invariant_ = true;
+      return;
+    }
+    auto &v0 = basis_[0];
+    std::copy(psi.begin(), psi.end(), v0.begin());
+    Scale(coeff_t(1. / beta0_), v0);
+
+    // the Krylov space is invariant once beta is at rounding level relative
+    // to the norm of T, estimated by its largest absolute row sum
+    dim_ = krylov_dim_;
+    invariant_ = false;
+    real_type tnorm = 0.;
+    for (int j = 0; j < krylov_dim_; ++j) {
+      apply(H, basis_[j], w_);
+      alphas_(j) = real(Dot(basis_[j], w_));
+      Add(basis_[j], w_, coeff_t(-alphas_(j)));
+      if (j > 0)
+        Add(basis_[j - 1], w_, coeff_t(-betas_(j - 1)));
+      for (int k = 0; k <= j; ++k)
+        Add(basis_[k], w_, -Dot(basis_[k], w_));
+      betas_(j) = Norm(w_);
+      tnorm = std::max(tnorm, std::abs(alphas_(j)) + betas_(j) +
+                                  ((j > 0) ? betas_(j - 1) : real_type(0.)));
+
+      if (betas_(j) <= eps * tnorm ||
+          betas_(j) < std::numeric_limits<real_type>::min()) {
+        dim_ = j + 1;
+        invariant_ = true;
+        break;
+      }
+      std::copy(w_.begin(), w_.end(), basis_[j + 1].begin());
+      Scale(coeff_t(1. / betas_(j)), basis_[j + 1]);
+    }
+
+    Vector<real_type> diag(dim_);
+    Vector<real_type> offdiag(std::max(dim_ - 1, 1));
+    for (int j = 0; j < dim_; ++j)
+      diag(j) = alphas_(j);
+    for (int j = 0; j < dim_ - 1; ++j)
+      offdiag(j) = betas_(j);
+    evecs_ = EigenSymTridiagInplace(diag, offdiag);
+    evals_ = diag;
+  }
+
+  // coeffs = exp(z dt T) e_1, returns the error estimate
+  real_type Coefficients(coeff_t z, real_type dt) {
+    for (int i = 0; i < dim_; ++i) {
+      coeff_t c = 0.;
+      for (int l = 0; l < dim_; ++l)
+        c += evecs_(i, l) * std::exp(z * dt * evals_(l)) * evecs_(0, l);
+      coeffs_(i) = c;
+    }
+    if (invariant_)
+      return 0.;
+    return beta0_ * betas_(dim_ - 1) * std::abs(coeffs_(dim_ - 1));
+  }
+
+  // psi = beta_0 V coeffs
+  void Combine(Vector<coeff_t> &psi) {
+    std::fill(psi.begin(), psi.end(), coeff_t(0.));
+    for (int j = 0; j < dim_; ++j)
+      Add(basis_[j], psi, beta0_ * coeffs_(j));
+  }
+};
+
+} // namespace lila
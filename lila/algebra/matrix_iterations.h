@@ -0,0 +1,370 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#include <lila/algebra/expm.h>
+#include <lila/algebra/mult.h>
+#include <lila/algebra/spectral_decomposition.h>
+#include <lila/arithmetic/add.h>
+#include <lila/arithmetic/norm.h>
+#include <lila/arithmetic/scale.h>
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/decomp/solve.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/special/special.h>
+
+namespace lila {
+
+// Matrix sign function, square root, inverse square root and polar
+// decomposition by iterations built from matrix-matrix products (Higham,
+// Functions of Matrices, ch. 5, 6 and 8), which run at the speed of a
+// multithreaded gemm. They converge quadratically once close to the solution
+// but need O(log cond(A)) steps to get there. If an iteration does not
+// converge within maxiter steps or breaks down on a singular iterate, the
+// result is computed from an eigendecomposition instead, which is reported
+// in the optional IterationInfo.
+
+template <class real_type> struct IterationInfo {
+  int iterations = 0;
+  real_type delta = 0.; // last relative change of the iterate
+  bool converged = false;
+  bool fallback = false; // result computed from an eigendecomposition
+};
+
+enum class SqrtMethod { NewtonSchulz, DenmanBeavers };
+
+namespace detail {
+
+template <class coeff_t> inline real_t<coeff_t> iteration_tol() {
+  return 100 * std::numeric_limits<real_t<coeff_t>>::epsilon();
+}
+
+// Converged if the relative change delta is below tol, or if it stagnates
+// after it has been below sqrt(tol), i.e. rounding errors dominate
+template <class real_type>
+inline bool iteration_converged(real_type delta, real_type delta_old,
+                                real_type tol) {
+  return (delta <= tol) ||
+         ((delta_old <= std::sqrt(tol)) && (delta > delta_old / 2));
+}
+
+// ||X_new - X||_F / ||X_new||_F
+template <class coeff_t>
+inline real_t<coeff_t> iteration_change(Matrix<coeff_t> const &Xnew,
+                                        Matrix<coeff_t> const &X) {
+  real_t<coeff_t> diff = 0.;
+  real_t<coeff_t> norm = 0.;
+  coeff_t const *xn = Xnew.data();
+  coeff_t const *x = X.data();
+  for (lila_size_t i = 0; i < X.size(); ++i) {
+    real_t<coeff_t> d = std::abs(xn[i] - x[i]);
+    real_t<coeff_t> a = std::abs(xn[i]);
+    diff += d * d;
+    norm += a * a;
+  }
+  return (norm > 0.) ? std::sqrt(diff / norm) : 0.;
+}
+
+// X = (X + X^H) / 2
+template <class coeff_t> inline void iteration_hermitize(Matrix<coeff_t> &X) {
+  for (lila_size_t j = 0; j < X.ncols(); ++j)
+    for (lila_size_t i = j; i < X.nrows(); ++i) {
+      coeff_t x = (X(i, j) + conj(X(j, i))) / real_t<coeff_t>(2.);
+      X(i, j) = x;
+      X(j, i) = conj(x);
+    }
+}
+
+// X = X^-1 by LU, returns false if X is singular. log|det X| is stored in
+// logdet if given.
+template <class coeff_t>
+inline bool iteration_inverse(Matrix<coeff_t> &X,
+                              std::vector<blas_size_t> &ipiv,
+                              std::vector<coeff_t> &work,
+                              real_t<coeff_t> *logdet = nullptr) {
+  blas_size_t n = X.nrows();
+  blas_size_t lwork = work.size();
+  blas_size_t info = 0;
+  blaslapack::getrf(&n, &n, LILA_BLAS_CAST(coeff_t, X.data()), &n,
+                    ipiv.data(), &info);
+  if (info != 0)
+    return false;
+  if (logdet) {
+    *logdet = 0.;
+    for (lila_size_t i = 0; i < X.nrows(); ++i)
+      *logdet += std::log(std::abs(X(i, i)));
+  }
+  blaslapack::getri(&n, LILA_BLAS_CAST(coeff_t, X.data()), &n, ipiv.data(),
+                    LILA_BLAS_CAST(coeff_t, work.data()), &lwork, &info);
+  return info == 0;
+}
+
+} // namespace detail
+
+// sign(A) of a Hermitian matrix by the Newton-Schulz iteration
+// X <- X (3 I - X^2) / 2 with X_0 = A / ||A||_1, two gemms per step. Small
+// eigenvalues only grow by a factor 3/2 per step, so nearly singular A fall
+// back to the eigendecomposition. sign(0) = 0.
+template <class coeff_t>
+inline Matrix<coeff_t>
+SignSym(Matrix<coeff_t> const &A,
+        real_t<coeff_t> tol = detail::iteration_tol<coeff_t>(),
+        int maxiter = 100, IterationInfo<real_t<coeff_t>> *info = nullptr) {
+  using real_type = real_t<coeff_t>;
+  assert(A.nrows() == A.ncols());
+  lila_size_t n = A.nrows();
+  IterationInfo<real_type> it;
+
+  // ||A||_1 bounds the spectral radius of A
+  real_type norm = Norm1(A);
+  Matrix<coeff_t> X = A;
+  if (norm > 0.)
+    Scale(coeff_t(1. / norm), X);
+  Matrix<coeff_t> P(n, n);
+  Matrix<coeff_t> Y(n, n);
+  real_type delta_old = std::numeric_limits<real_type>::infinity();
+  while ((norm > 0.) && (it.iterations < maxiter)) {
+    Mult(X, X, P, coeff_t(-0.5));
+    detail::add_identity(coeff_t(1.5), P);
+    Mult(X, P, Y);
+    it.delta = detail::iteration_change(Y, X);
+    ++it.iterations;
+    swap(X, Y);
+    if (!std::isfinite(it.delta))
+      break;
+    if (detail::iteration_converged(it.delta, delta_old, tol)) {
+      it.converged = true;
+      break;
+    }
+    delta_old = it.delta;
+  }
+
+  if (it.converged || (norm == 0.))
+    detail::iteration_hermitize(X);
+  else {
+    it.fallback = true;
+    SpectralDecomposition<coeff_t> sd(A);
+    X = sd.apply([](real_type x) { return real_type((x > 0.) - (x < 0.)); });
+  }
+  if (info)
+    *info = it;
+  return X;
+}
+
+// (A^1/2, A^-1/2) of a Hermitian positive definite matrix. Newton-Schulz is
+// the coupled iteration T = (3 I - Z Y) / 2, Y <- Y T, Z <- T Z with
+// Y_0 = A / ||A||_1 and Z_0 = I, three gemms per step and no inverses.
+// Denman-Beavers (product form with determinant scaling) needs one inverse
+// and two gemms per step, but far fewer steps for ill-conditioned A.
+template <class coeff_t>
+inline std::pair<Matrix<coeff_t>, Matrix<coeff_t>> SqrtInvSqrtSym(
+    Matrix<coeff_t> const &A, SqrtMethod method = SqrtMethod::NewtonSchulz,
+    real_t<coeff_t> tol = detail::iteration_tol<coeff_t>(),
+    int maxiter = 100, IterationInfo<real_t<coeff_t>> *info = nullptr) {
+  using real_type = real_t<coeff_t>;
+  assert(A.nrows() == A.ncols());
+  lila_size_t n = A.nrows();
+  IterationInfo<real_type> it;
+
+  real_type norm = Norm1(A);
+  Matrix<coeff_t> Y = A;
+  Matrix<coeff_t> Z = Identity<coeff_t>(n);
+  Matrix<coeff_t> T(n, n);
+  Matrix<coeff_t> Ynew(n, n);
+  Matrix<coeff_t> Znew(n, n);
+  real_type delta_old = std::numeric_limits<real_type>::infinity();
+
+  if ((method == SqrtMethod::NewtonSchulz) && (norm > 0.)) {
+    Scale(coeff_t(1. / norm), Y);
+    while (it.iterations < maxiter) {
+      Mult(Z, Y, T, coeff_t(-0.5));
+      detail::add_identity(coeff_t(1.5), T);
+      Mult(Y, T, Ynew);
+      Mult(T, Z, Znew);
+      it.delta = std::max(detail::iteration_change(Ynew, Y),
+                          detail::iteration_change(Znew, Z));
+      ++it.iterations;
+      swap(Y, Ynew);
+      swap(Z, Znew);
+      if (!std::isfinite(it.delta))
+        break;
+      if (detail::iteration_converged(it.delta, delta_old, tol)) {
+        it.converged = true;
+        break;
+      }
+      delta_old = it.delta;
+    }
+    Scale(coeff_t(std::sqrt(norm)), Y);
+    Scale(coeff_t(1. / std::sqrt(norm)), Z);
+  } else if ((method == SqrtMethod::DenmanBeavers) && (n > 0)) {
+    // M <- (I + (mu^2 M + mu^-2 M^-1) / 2) / 2,
+    // Y <- mu Y (I + mu^-2 M^-1) / 2, Z <- mu Z (I + mu^-2 M^-1) / 2
+    Matrix<coeff_t> M = A;
+    Matrix<coeff_t> Minv(n, n);
+    std::vector<blas_size_t> ipiv(n);
+    std::vector<coeff_t> work(n * n);
+    bool scaling = true;
+    while (it.iterations < maxiter) {
+      Minv = M;
+      real_type logdet = 0.;
+      if (!detail::iteration_inverse(Minv, ipiv, work, &logdet))
+        break;
+      real_type mu = scaling ? std::exp(-logdet / (2 * n)) : 1.;
+      real_type mu2 = mu * mu;
+
+      T = Minv;
+      Scale(coeff_t(mu / (2 * mu2)), T);
+      detail::add_identity(coeff_t(mu / 2), T);
+      Mult(Y, T, Ynew);
+      Mult(Z, T, Znew);
+      Scale(coeff_t(mu2 / 4), M);
+      Add(Minv, M, coeff_t(1. / (4 * mu2)));
+      detail::add_identity(coeff_t(0.5), M);
+
+      it.delta = std::max(detail::iteration_change(Ynew, Y),
+                          detail::iteration_change(Znew, Z));
+      ++it.iterations;
+      swap(Y, Ynew);
+      swap(Z, Znew);
+      if (!std::isfinite(it.delta))
+        break;
+      if (detail::iteration_converged(it.delta, delta_old, tol)) {
+        it.converged = true;
+        break;
+      }
+      scaling = scaling && (it.delta > 1e-2);
+      delta_old = it.delta;
+    }
+  }
+
+  if (it.converged || (n == 0)) {
+    it.converged = true;
+    detail::iteration_hermitize(Y);
+    detail::iteration_hermitize(Z);
+  } else {
+    it.fallback = true;
+    SpectralDecomposition<coeff_t> sd(A);
+    Y = sd.apply(
+        [](real_type x) { return std::sqrt(std::max(x, real_type(0.))); });
+    Z = sd.apply([](real_type x) { return real_type(1.) / std::sqrt(x); });
+  }
+  if (info)
+    *info = it;
+  return {Y, Z};
+}
+
+template <class coeff_t>
+inline Matrix<coeff_t> SqrtSym(
+    Matrix<coeff_t> const &A, SqrtMethod method = SqrtMethod::NewtonSchulz,
+    real_t<coeff_t> tol = detail::iteration_tol<coeff_t>(),
+    int maxiter = 100, IterationInfo<real_t<coeff_t>> *info = nullptr) {
+  return SqrtInvSqrtSym(A, method, tol, maxiter, info).first;
+}
+
+template <class coeff_t>
+inline Matrix<coeff_t> InvSqrtSym(
+    Matrix<coeff_t> const &A, SqrtMethod method = SqrtMethod::NewtonSchulz,
+    real_t<coeff_t> tol = detail::iteration_tol<coeff_t>(),
+    int maxiter = 100, IterationInfo<real_t<coeff_t>> *info = nullptr) {
+  return SqrtInvSqrtSym(A, method, tol, maxiter, info).second;
+}
+
+// Polar decomposition A = U H of an m x n matrix, m >= n, with U having
+// orthonormal columns and H Hermitian positive semidefinite. A tall A is
+// first reduced to its n x n triangular factor R by a QR decomposition. The
+// square case runs the Newton iteration X <- (mu X + mu^-1 X^-H) / 2 with
+// Frobenius norm scaling mu until the iterate is close to unitary, and
+// finishes with the Newton-Schulz iteration X <- X (3 I - X^H X) / 2 which
+// only needs gemms. Singular A fall back to the eigendecomposition of A^H A,
+// in which case U is a partial isometry.
+template <class coeff_t>
+inline std::pair<Matrix<coeff_t>, Matrix<coeff_t>>
+Polar(Matrix<coeff_t> const &A,
+      real_t<coeff_t> tol = detail::iteration_tol<coeff_t>(),
+      int maxiter = 100, IterationInfo<real_t<coeff_t>> *info = nullptr) {
+  using real_type = real_t<coeff_t>;
+  lila_size_t m = A.nrows();
+  lila_size_t n = A.ncols();
+  assert(m >= n);
+
+  if (m > n) {
+    auto QR = A;
+    auto tau = QRDecompose(QR);
+    auto R = GetUpper(QR);
+    auto UH = Polar(R, tol, maxiter, info);
+
+    // U = Q [U_R; 0], without forming Q
+    auto U = UH.first;
+    U.resize(m, n);
+    QRApplyQ(QR, tau, U);
+    return {U, UH.second};
+  }
+
+  IterationInfo<real_type> it;
+  Matrix<coeff_t> X = A;
+  Matrix<coeff_t> Xnew(n, n);
+  Matrix<coeff_t> P(n, n);
+  std::vector<blas_size_t> ipiv(n);
+  std::vector<coeff_t> work(n * n);
+  bool newton = true;
+  real_type delta_old = std::numeric_limits<real_type>::infinity();
+  while ((n > 0) && (it.iterations < maxiter)) {
+    if (newton) {
+      P = X;
+      if (!detail::iteration_inverse(P, ipiv, work))
+        break;
+      real_type mu = std::sqrt(Norm(P) / Norm(X));
+      for (lila_size_t j = 0; j < n; ++j)
+        for (lila_size_t i = 0; i < n; ++i)
+          Xnew(i, j) = (mu * X(i, j) + conj(P(j, i)) / mu) / real_type(2.);
+    } else {
+      Mult(X, X, P, coeff_t(-0.5), coeff_t(0.), 'C', 'N');
+      detail::add_identity(coeff_t(1.5), P);
+      Mult(X, P, Xnew);
+    }
+    it.delta = detail::iteration_change(Xnew, X);
+    ++it.iterations;
+    swap(X, Xnew);
+    if (!std::isfinite(it.delta))
+      break;
+    if (detail::iteration_converged(it.delta, delta_old, tol)) {
+      it.converged = true;
+      break;
+    }
+    newton = newton && (it.delta > 1e-2);
+    delta_old = it.delta;
+  }
+
+  Matrix<coeff_t> H;
+  if (it.converged || (n == 0)) {
+    it.converged = true;
+    Mult(X, A, H, coeff_t(1.), coeff_t(0.), 'C', 'N');
+    detail::iteration_hermitize(H);
+  } else {
+    // A^H A = V S^2 V^H, H = V S V^H, U = A V S^-1 V^H (pseudo-inverse)
+    it.fallback = true;
+    Matrix<coeff_t> G;
+    Mult(A, A, G, coeff_t(1.), coeff_t(0.), 'C', 'N');
+    SpectralDecomposition<coeff_t> sd(G);
+    auto const &evals = sd.eigenvalues();
+    real_type cutoff = n * std::numeric_limits<real_type>::epsilon() *
+                       std::max(std::abs(evals(0)), std::abs(evals(n - 1)));
+    H = sd.apply(
+        [](real_type x) { return std::sqrt(std::max(x, real_type(0.))); });
+    auto Hpinv = sd.apply([cutoff](real_type x) {
+      return (x > cutoff) ? real_type(1.) / std::sqrt(x) : real_type(0.);
+    });
+    X = Mult(A, Hpinv);
+  }
+  if (info)
+    *info = it;
+  return {X, H};
+}
+
+} // namespace lila
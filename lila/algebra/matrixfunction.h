@@ -2,6 +2,10 @@
 
 #include <math.h>
 
+#include <cassert>
+#include <cmath>
+#include <vector>
+
 #include <lila/matrix.h>
 #include <lila/arithmetic/add.h>
 #include <lila/algebra/mult.h>
@@ -12,27 +16,90 @@
 
 namespace lila {
 
+namespace detail {
+
+// res = Q diag(fvals) Q^H. If all fvals are real and of the same sign this is
+// +/- (Q |f|^1/2)(Q |f|^1/2)^H, a single rank-k update (syrk / herk) which
+// only computes one triangle. res may be the same matrix as Q.
+template <class coeff_t>
+inline void spectral_reconstruct(Matrix<coeff_t> const &Q,
+                                 std::vector<coeff_t> const &fvals,
+                                 Matrix<coeff_t> &res) {
+  using real_type = real_t<coeff_t>;
+  lila_size_t n = Q.nrows();
+  lila_size_t k = Q.ncols();
+  assert((lila_size_t)fvals.size() == k);
+
+  bool nonnegative = true;
+  bool nonpositive = true;
+  for (auto f : fvals) {
+    nonnegative = nonnegative && (imag(f) == 0) && (real(f) >= 0);
+    nonpositive = nonpositive && (imag(f) == 0) && (real(f) <= 0);
+  }
+
+  Matrix<coeff_t> B = Q;
+  blas_size_t bn = n;
+  blas_size_t bk = k;
+  blas_size_t inc = 1;
+  if (nonnegative || nonpositive) {
+    for (lila_size_t j = 0; j < k; ++j) {
+      coeff_t scale = std::sqrt(std::abs(real(fvals[j])));
+      blaslapack::scal(&bn, LILA_BLAS_CAST(coeff_t, &scale),
+                       LILA_BLAS_CAST(coeff_t, B.data() + j * n), &inc);
+    }
+    if ((res.nrows() != n) || (res.ncols() != n))
+      res = Matrix<coeff_t>(n, n);
+    char up = 'U';
+    char trans = 'N';
+    real_type alpha = nonnegative ? 1. : -1.;
+    real_type beta = 0.;
+    if constexpr (is_complex<coeff_t>()) {
+      blaslapack::herk(&up, &trans, &bn, &bk, &alpha,
+                       LILA_BLAS_CONST_CAST(coeff_t, B.data()), &bn, &beta,
+                       LILA_BLAS_CAST(coeff_t, res.data()), &bn);
+    } else {
+      blaslapack::syrk(&up, &trans, &bn, &bk, &alpha,
+                       LILA_BLAS_CONST_CAST(coeff_t, B.data()), &bn, &beta,
+                       LILA_BLAS_CAST(coeff_t, res.data()), &bn);
+    }
+
+    // Fill in the lower triangle
+    for (lila_size_t j = 0; j < n; ++j)
+      for (lila_size_t i = j + 1; i < n; ++i)
+        res(i, j) = conj(res(j, i));
+  } else {
+    for (lila_size_t j = 0; j < k; ++j) {
+      coeff_t f = fvals[j];
+      blaslapack::scal(&bn, LILA_BLAS_CAST(coeff_t, &f),
+                       LILA_BLAS_CAST(coeff_t, B.data() + j * n), &inc);
+    }
+    Matrix<coeff_t> C(n, n);
+    gemm('N', 'C', n, n, k, coeff_t(1.), B.data(), n, Q.data(), n,
+         coeff_t(0.), C.data(), n);
+    swap(res, C);
+  }
+}
+
+} // namespace detail
+
+// f(A) = Q f(L) Q^H for a Hermitian matrix A = Q L Q^H, fun is called as
+// fun(coeff_t &x) on every eigenvalue x
 template <class coeff_t, class function_t>
 inline void FunctionSym(Matrix<coeff_t> &matrix, function_t fun,
                         char uplo = 'U') {
   assert(matrix.m() == matrix.n());
+  lila_size_t n = matrix.n();
+  if (n == 0)
+    return;
 
-  auto Qmat = matrix;
-  auto eigs = EigenSymInplace(Qmat, true, uplo);
-  auto Bmat = Qmat;
-
-  // Multiply with diagonal matrix, where function has been applied
-  for (lila_size_t j = 0; j < eigs.n(); ++j) {
-    coeff_t fun_of_eig = static_cast<coeff_t>(eigs(j));
-    fun(fun_of_eig);
-
-    // Scale j-th column
-    // blaslapack::scal(&n, LILA_BLAS_CAST(coeff_t, &fun_of_eig),
-    //                  LILA_BLAS_CAST(coeff_t, Bmat.data()) + j * n, &incx);
-    Bmat(ALL, j) *= fun_of_eig;
+  // matrix holds the eigenvectors Q from here on
+  auto eigs = EigenSymInplace(matrix, true, uplo);
+  std::vector<coeff_t> fvals(n);
+  for (lila_size_t j = 0; j < n; ++j) {
+    fvals[j] = static_cast<coeff_t>(eigs(j));
+    fun(fvals[j]);
   }
-  Zeros(matrix);
-  Mult(Bmat, Qmat, matrix, (coeff_t)1., (coeff_t)0., 'N', 'C');
+  detail::spectral_reconstruct(matrix, fvals, matrix);
 }
 
 template <class coeff_t>
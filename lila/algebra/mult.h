@@ -1,6 +1,12 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <memory>
+#include <vector>
+
 #include <lila/blaslapack/blaslapack.h>
+#include <lila/common.h>
 #include <lila/matrix.h>
 #include <lila/numeric/complex.h>
 #include <lila/special/special.h>
@@ -49,14 +55,16 @@ template <class coeff_t>
 inline void Mult(Matrix<coeff_t> const &A, Vector<coeff_t> const &X,
                  Vector<coeff_t> &Y, coeff_t alpha = 1., coeff_t beta = 0.,
                  char trans = 'N') {
-  // matrix dimensions
-  blas_size_t m = (trans == 'N') ? A.nrows() : A.ncols();
-  blas_size_t n = (trans == 'N') ? A.ncols() : A.nrows();
+  // matrix dimensions (gemv takes the dimensions of A, not of op(A))
+  blas_size_t m = A.nrows();
+  blas_size_t n = A.ncols();
+  lila_size_t xsize = (trans == 'N') ? n : m;
+  lila_size_t ysize = (trans == 'N') ? m : n;
 
-  assert(n == X.size()); // Check if valid multiplication dimensions
+  assert(xsize == X.size()); // Check if valid multiplication dimensions
 
-  if (Y.size() == 0)
-    Y = Zeros<coeff_t>(n);
+  if (Y.size() != ysize)
+    Y = Zeros<coeff_t>(ysize);
 
   // leading dimensions
   blas_size_t lda = A.nrows();
@@ -76,6 +84,264 @@ inline Vector<coeff_t> Mult(Matrix<coeff_t> const &A,
   return Y;
 }
 
+namespace detail {
+
+// Leading dimension of a Matrix or MatrixView as passed to BLAS, views need
+// contiguous columns
+template <class coeff_t>
+inline blas_size_t blas_ld(Matrix<coeff_t> const &A) {
+  return std::max(A.m(), (lila_size_t)1);
+}
+
+template <class coeff_t>
+inline blas_size_t blas_ld(MatrixView<coeff_t> const &A) {
+  assert(A.incm() == 1);
+  return std::max(A.ld() * A.incn(), (lila_size_t)1);
+}
+
+// Vector as an n x 1 MatrixView
+template <class coeff_t>
+inline MatrixView<coeff_t> column_view(Vector<coeff_t> &x) {
+  std::shared_ptr<coeff_t> data(x.storage(), x.data());
+  return MatrixView<coeff_t>(data, x.size(), 1, x.size(), 1, 1);
+}
+
+// Contiguous VectorView as an n x 1 MatrixView
+template <class coeff_t>
+inline MatrixView<coeff_t> column_view(VectorView<coeff_t> x) {
+  assert(x.inc() == 1);
+  return MatrixView<coeff_t>(x.storage(), x.size(), 1, x.size(), 1, 1);
+}
+
+// Copy the uplo triangle of the n x n Hermitian matrix C to the other one
+template <class coeff_t>
+inline void fill_hermitian(coeff_t *C, lila_size_t n, lila_size_t ldc,
+                           char uplo) {
+  for (lila_size_t j = 0; j < n; ++j)
+    for (lila_size_t i = j + 1; i < n; ++i) {
+      if (uplo == 'U')
+        C[i + j * ldc] = conj(C[j + i * ldc]);
+      else
+        C[j + i * ldc] = conj(C[i + j * ldc]);
+    }
+}
+
+// Set the strict uplo triangle of the n x n matrix C to zero, columns in
+// parallel
+template <class coeff_t>
+inline void zero_triangle(coeff_t *C, lila_size_t n, lila_size_t ldc,
+                          char uplo) {
+  assert((uplo == 'U') || (uplo == 'L'));
+  LILA_OMP(omp parallel for schedule(static, 1) if (n * n >= parallel_min_size))
+  for (lila_size_t j = 0; j < n; ++j) {
+    if (uplo == 'L')
+      std::fill(C + j + 1 + j * ldc, C + n + j * ldc, coeff_t(0.));
+    else
+      std::fill(C + j * ldc, C + j + j * ldc, coeff_t(0.));
+  }
+}
+
+} // namespace detail
+
+// C = alpha A B + beta C (side 'L') or C = alpha B A + beta C (side 'R') for
+// a Hermitian (symmetric if real) A, of which only the uplo triangle is
+// referenced (symm / hemm)
+template <class coeff_t>
+inline void MultSym(MatrixView<coeff_t> const &A, MatrixView<coeff_t> const &B,
+                    MatrixView<coeff_t> C, coeff_t alpha = 1.,
+                    coeff_t beta = 0., char side = 'L', char uplo = 'U') {
+  blas_size_t m = C.m();
+  blas_size_t n = C.n();
+  assert(A.m() == A.n());
+  assert(A.m() == ((side == 'L') ? C.m() : C.n()));
+  assert((B.m() == C.m()) && (B.n() == C.n()));
+  blas_size_t lda = detail::blas_ld(A);
+  blas_size_t ldb = detail::blas_ld(B);
+  blas_size_t ldc = detail::blas_ld(C);
+  if constexpr (is_complex<coeff_t>()) {
+    blaslapack::hemm(&side, &uplo, &m, &n, LILA_BLAS_CAST(coeff_t, &alpha),
+                     LILA_BLAS_CONST_CAST(coeff_t, A.data()), &lda,
+                     LILA_BLAS_CONST_CAST(coeff_t, B.data()), &ldb,
+                     LILA_BLAS_CAST(coeff_t, &beta),
+                     LILA_BLAS_CAST(coeff_t, C.data()), &ldc);
+  } else {
+    blaslapack::symm(&side, &uplo, &m, &n, LILA_BLAS_CAST(coeff_t, &alpha),
+                     LILA_BLAS_CONST_CAST(coeff_t, A.data()), &lda,
+                     LILA_BLAS_CONST_CAST(coeff_t, B.data()), &ldb,
+                     LILA_BLAS_CAST(coeff_t, &beta),
+                     LILA_BLAS_CAST(coeff_t, C.data()), &ldc);
+  }
+}
+
+template <class coeff_t>
+inline void MultSym(Matrix<coeff_t> const &A, Matrix<coeff_t> const &B,
+                    Matrix<coeff_t> &C, coeff_t alpha = 1., coeff_t beta = 0.,
+                    char side = 'L', char uplo = 'U') {
+  if ((C.m() == 0) && (C.n() == 0))
+    C = Zeros<coeff_t>(B.m(), B.n());
+  if ((C.m() != B.m()) || (C.n() != B.n()))
+    C.resize(B.m(), B.n());
+  MultSym(MatrixView<coeff_t>(A), MatrixView<coeff_t>(B),
+          MatrixView<coeff_t>(C), alpha, beta, side, uplo);
+}
+
+template <class coeff_t>
+inline Matrix<coeff_t> MultSym(Matrix<coeff_t> const &A,
+                               Matrix<coeff_t> const &B, char side = 'L') {
+  Matrix<coeff_t> C;
+  MultSym(A, B, C, coeff_t(1.), coeff_t(0.), side);
+  return C;
+}
+
+// y = alpha A x + beta y for a Hermitian (symmetric if real) A (symv / hemv)
+template <class coeff_t>
+inline void MultSym(MatrixView<coeff_t> const &A, VectorView<coeff_t> const &X,
+                    VectorView<coeff_t> Y, coeff_t alpha = 1.,
+                    coeff_t beta = 0., char uplo = 'U') {
+  blas_size_t n = A.m();
+  assert(A.m() == A.n());
+  assert((X.size() == A.n()) && (Y.size() == A.m()));
+  blas_size_t lda = detail::blas_ld(A);
+  blas_size_t incx = X.inc();
+  blas_size_t incy = Y.inc();
+  if constexpr (is_complex<coeff_t>()) {
+    blaslapack::hemv(&uplo, &n, LILA_BLAS_CAST(coeff_t, &alpha),
+                     LILA_BLAS_CONST_CAST(coeff_t, A.data()), &lda,
+                     LILA_BLAS_CONST_CAST(coeff_t, X.data()), &incx,
+                     LILA_BLAS_CAST(coeff_t, &beta),
+                     LILA_BLAS_CAST(coeff_t, Y.data()), &incy);
+  } else {
+    blaslapack::symv(&uplo, &n, LILA_BLAS_CAST(coeff_t, &alpha),
+                     LILA_BLAS_CONST_CAST(coeff_t, A.data()), &lda,
+                     LILA_BLAS_CONST_CAST(coeff_t, X.data()), &incx,
+                     LILA_BLAS_CAST(coeff_t, &beta),
+                     LILA_BLAS_CAST(coeff_t, Y.data()), &incy);
+  }
+}
+
+template <class coeff_t>
+inline void MultSym(Matrix<coeff_t> const &A, Vector<coeff_t> const &X,
+                    Vector<coeff_t> &Y, coeff_t alpha = 1., coeff_t beta = 0.,
+                    char uplo = 'U') {
+  if (Y.size() != A.m())
+    Y = Zeros<coeff_t>(A.m());
+  MultSym(MatrixView<coeff_t>(A), VectorView<coeff_t>(X),
+          VectorView<coeff_t>(Y), alpha, beta, uplo);
+}
+
+template <class coeff_t>
+inline Vector<coeff_t> MultSym(Matrix<coeff_t> const &A,
+                               Vector<coeff_t> const &X) {
+  Vector<coeff_t> Y;
+  MultSym(A, X, Y);
+  return Y;
+}
+
+// Gram matrix C = alpha A^H A + beta C (trans 'C') or C = alpha A A^H +
+// beta C (trans 'N') by a rank-k update (syrk / herk). Only the upper
+// triangle is computed and then copied to the lower one, which halves the
+// flops compared to gemm.
+template <class coeff_t>
+inline void Gram(MatrixView<coeff_t> const &A, MatrixView<coeff_t> C,
+                 real_t<coeff_t> alpha = 1., real_t<coeff_t> beta = 0.,
+                 char trans = 'C') {
+  assert((trans == 'N') || (trans == 'C'));
+  blas_size_t n = (trans == 'N') ? A.m() : A.n();
+  blas_size_t k = (trans == 'N') ? A.n() : A.m();
+  assert((C.m() == n) && (C.n() == n));
+  blas_size_t lda = detail::blas_ld(A);
+  blas_size_t ldc = detail::blas_ld(C);
+  char uplo = 'U';
+  if constexpr (is_complex<coeff_t>()) {
+    blaslapack::herk(&uplo, &trans, &n, &k, &alpha,
+                     LILA_BLAS_CONST_CAST(coeff_t, A.data()), &lda, &beta,
+                     LILA_BLAS_CAST(coeff_t, C.data()), &ldc);
+  } else {
+    char transr = (trans == 'N') ? 'N' : 'T';
+    blaslapack::syrk(&uplo, &transr, &n, &k, &alpha,
+                     LILA_BLAS_CONST_CAST(coeff_t, A.data()), &lda, &beta,
+                     LILA_BLAS_CAST(coeff_t, C.data()), &ldc);
+  }
+  detail::fill_hermitian(C.data(), n, ldc, uplo);
+}
+
+template <class coeff_t>
+inline void Gram(Matrix<coeff_t> const &A, Matrix<coeff_t> &C,
+                 real_t<coeff_t> alpha = 1., real_t<coeff_t> beta = 0.,
+                 char trans = 'C') {
+  lila_size_t n = (trans == 'N') ? A.m() : A.n();
+  if ((C.m() == 0) && (C.n() == 0))
+    C = Zeros<coeff_t>(n, n);
+  if ((C.m() != n) || (C.n() != n))
+    C.resize(n, n);
+  Gram(MatrixView<coeff_t>(A), MatrixView<coeff_t>(C), alpha, beta, trans);
+}
+
+template <class coeff_t>
+inline Matrix<coeff_t> Gram(Matrix<coeff_t> const &A, char trans = 'C') {
+  Matrix<coeff_t> C;
+  Gram(A, C, real_t<coeff_t>(1.), real_t<coeff_t>(0.), trans);
+  return C;
+}
+
+// B = alpha op(A) B (side 'L') or B = alpha B op(A) (side 'R') for a
+// triangular A, of which only the uplo triangle is referenced (trmm). diag
+// 'U' assumes a unit diagonal.
+template <class coeff_t>
+inline void MultTriInplace(MatrixView<coeff_t> const &A,
+                           MatrixView<coeff_t> B, coeff_t alpha = 1.,
+                           char side = 'L', char uplo = 'U',
+                           char trans = 'N', char diag = 'N') {
+  blas_size_t m = B.m();
+  blas_size_t n = B.n();
+  assert(A.m() == A.n());
+  assert(A.m() == ((side == 'L') ? B.m() : B.n()));
+  blas_size_t lda = detail::blas_ld(A);
+  blas_size_t ldb = detail::blas_ld(B);
+  blaslapack::trmm(&side, &uplo, &trans, &diag, &m, &n,
+                   LILA_BLAS_CAST(coeff_t, &alpha),
+                   LILA_BLAS_CONST_CAST(coeff_t, A.data()), &lda,
+                   LILA_BLAS_CAST(coeff_t, B.data()), &ldb);
+}
+
+template <class coeff_t>
+inline void MultTriInplace(Matrix<coeff_t> const &A, Matrix<coeff_t> &B,
+                           coeff_t alpha = 1., char side = 'L',
+                           char uplo = 'U', char trans = 'N',
+                           char diag = 'N') {
+  MultTriInplace(MatrixView<coeff_t>(A), MatrixView<coeff_t>(B), alpha, side,
+                 uplo, trans, diag);
+}
+
+template <class coeff_t>
+inline void MultTriInplace(Matrix<coeff_t> const &A, Vector<coeff_t> &X,
+                           coeff_t alpha = 1., char uplo = 'U',
+                           char trans = 'N', char diag = 'N') {
+  MultTriInplace(MatrixView<coeff_t>(A), detail::column_view(X), alpha, 'L',
+                 uplo, trans, diag);
+}
+
+template <class coeff_t>
+inline Matrix<coeff_t> MultTri(Matrix<coeff_t> const &A,
+                               Matrix<coeff_t> const &B, char side = 'L',
+                               char uplo = 'U', char trans = 'N') {
+  auto C = B;
+  MultTriInplace(A, C, coeff_t(1.), side, uplo, trans);
+  return C;
+}
+
+template <class coeff_t>
+inline Vector<coeff_t> MultTri(Matrix<coeff_t> const &A,
+                               Vector<coeff_t> const &X, char uplo = 'U',
+                               char trans = 'N') {
+  auto Y = X;
+  MultTriInplace(A, Y, coeff_t(1.), uplo, trans);
+  return Y;
+}
+
+// Kronecker product C = A (x) B, i.e. C(p*r + v, q*s + w) = A(r, s) * B(v, w).
+// Every column of C is a sequence of scaled columns of B, so C is written
+// column by column (in parallel when compiled with OpenMP).
 template <class coeff_t>
 inline void Kron(const Matrix<coeff_t> &A, const Matrix<coeff_t> &B,
                  Matrix<coeff_t> &C) {
@@ -86,12 +352,154 @@ inline void Kron(const Matrix<coeff_t> &A, const Matrix<coeff_t> &B,
 
   lila_size_t mc = m * p;
   lila_size_t nc = n * q;
-  C.resize(mc, nc);
-  for (int s = 0; s < n; ++s)
-    for (int r = 0; r < m; ++r)
-      for (int w = 0; w < q; ++w)
-        for (int v = 0; v < p; ++v)
-          C(p * r + v, q * s + w) = A(r, s) * B(v, w);
+  if ((C.m() != mc) || (C.n() != nc))
+    C = Matrix<coeff_t>(mc, nc);
+
+  coeff_t const *a = A.data();
+  coeff_t const *b = B.data();
+  coeff_t *c = C.data();
+  LILA_OMP(omp parallel for if (mc * nc >= parallel_min_size))
+  for (lila_size_t col = 0; col < nc; ++col) {
+    lila_size_t s = col / q;
+    lila_size_t w = col % q;
+    coeff_t const *acol = a + s * m;
+    coeff_t const *bcol = b + w * p;
+    coeff_t *ccol = c + col * mc;
+    for (lila_size_t r = 0; r < m; ++r) {
+      coeff_t ars = acol[r];
+      coeff_t *cblock = ccol + r * p;
+      for (lila_size_t v = 0; v < p; ++v)
+        cblock[v] = ars * bcol[v];
+    }
+  }
+}
+
+template <class coeff_t>
+inline Matrix<coeff_t> Kron(const Matrix<coeff_t> &A,
+                            const Matrix<coeff_t> &B) {
+  Matrix<coeff_t> C;
+  Kron(A, B, C);
+  return C;
+}
+
+namespace detail {
+
+// gemm on raw column-major buffers
+template <class coeff_t>
+inline void gemm(char transa, char transb, lila_size_t m, lila_size_t n,
+                 lila_size_t k, coeff_t alpha, coeff_t const *A,
+                 lila_size_t lda, coeff_t const *B, lila_size_t ldb,
+                 coeff_t beta, coeff_t *C, lila_size_t ldc) {
+  blas_size_t bm = m;
+  blas_size_t bn = n;
+  blas_size_t bk = k;
+  blas_size_t blda = lda;
+  blas_size_t bldb = ldb;
+  blas_size_t bldc = ldc;
+  blaslapack::gemm(&transa, &transb, &bm, &bn, &bk,
+                   LILA_BLAS_CAST(coeff_t, &alpha),
+                   LILA_BLAS_CONST_CAST(coeff_t, A), &blda,
+                   LILA_BLAS_CONST_CAST(coeff_t, B), &bldb,
+                   LILA_BLAS_CAST(coeff_t, &beta), LILA_BLAS_CAST(coeff_t, C),
+                   &bldc);
+}
+
+// gemv on raw column-major buffers
+template <class coeff_t>
+inline void gemv(char trans, lila_size_t m, lila_size_t n, coeff_t alpha,
+                 coeff_t const *A, lila_size_t lda, coeff_t const *x,
+                 lila_size_t incx, coeff_t beta, coeff_t *y,
+                 lila_size_t incy) {
+  blas_size_t bm = m;
+  blas_size_t bn = n;
+  blas_size_t blda = lda;
+  blas_size_t bincx = incx;
+  blas_size_t bincy = incy;
+  blaslapack::gemv(&trans, &bm, &bn, LILA_BLAS_CAST(coeff_t, &alpha),
+                   LILA_BLAS_CONST_CAST(coeff_t, A), &blda,
+                   LILA_BLAS_CONST_CAST(coeff_t, x), &bincx,
+                   LILA_BLAS_CAST(coeff_t, &beta), LILA_BLAS_CAST(coeff_t, y),
+                   &bincy);
+}
+
+} // namespace detail
+
+// y = alpha * (A (x) B) x + beta * y without forming the Kronecker product.
+// With x reshaped to the (q x n) matrix X (column-major), (A (x) B) x is
+// vec(B X A^T), which are two gemms with O(pn + pm) workspace.
+template <class coeff_t>
+inline void KronMult(Matrix<coeff_t> const &A, Matrix<coeff_t> const &B,
+                     Vector<coeff_t> const &x, Vector<coeff_t> &y,
+                     coeff_t alpha = 1., coeff_t beta = 0.) {
+  lila_size_t m = A.nrows();
+  lila_size_t n = A.ncols();
+  lila_size_t p = B.nrows();
+  lila_size_t q = B.ncols();
+  assert(x.size() == n * q);
+  if (y.size() != m * p)
+    y = Vector<coeff_t>(m * p);
+
+  // T = B X,  Y = alpha T A^T + beta Y
+  Vector<coeff_t> T(p * n);
+  detail::gemm('N', 'N', p, n, q, (coeff_t)1., B.data(), p, x.data(), q,
+               (coeff_t)0., T.data(), p);
+  detail::gemm('N', 'T', p, m, n, alpha, T.data(), p, A.data(), m, beta,
+               y.data(), p);
+}
+
+template <class coeff_t>
+inline Vector<coeff_t> KronMult(Matrix<coeff_t> const &A,
+                                Matrix<coeff_t> const &B,
+                                Vector<coeff_t> const &x) {
+  Vector<coeff_t> y(A.nrows() * B.nrows());
+  KronMult(A, B, x, y);
+  return y;
+}
+
+// y = (A_1 (x) A_2 (x) ... (x) A_k) x without forming the Kronecker product.
+// x is treated as a tensor whose last index runs fastest and the factors are
+// applied one mode at a time: for factor j the tensor is a sequence of
+// (L x n_j) column-major blocks, L being the size of all faster modes, and
+// each block is multiplied by A_j^T with a gemm.
+template <class coeff_t>
+inline Vector<coeff_t> KronMult(std::vector<Matrix<coeff_t>> const &factors,
+                                Vector<coeff_t> const &x) {
+  lila_size_t k = factors.size();
+  std::vector<lila_size_t> dims(k);
+  lila_size_t size = 1;
+  for (lila_size_t j = 0; j < k; ++j) {
+    dims[j] = factors[j].ncols();
+    size *= dims[j];
+  }
+  assert(x.size() == size);
+
+  Vector<coeff_t> current = x;
+  Vector<coeff_t> next;
+  for (lila_size_t j = k - 1; j >= 0; --j) {
+    auto const &Aj = factors[j];
+    lila_size_t mj = Aj.nrows();
+    lila_size_t nj = Aj.ncols();
+    lila_size_t L = 1;
+    for (lila_size_t i = j + 1; i < k; ++i)
+      L *= dims[i];
+    lila_size_t R = size / (L * nj);
+
+    next.resize(L * mj * R);
+    if (L == 1) {
+      detail::gemm('N', 'N', mj, R, nj, (coeff_t)1., Aj.data(), mj,
+                   current.data(), nj, (coeff_t)0., next.data(), mj);
+    } else {
+      LILA_OMP(omp parallel for if (R > 1 && L * nj * R >= parallel_min_size))
+      for (lila_size_t r = 0; r < R; ++r)
+        detail::gemm('N', 'T', L, mj, nj, (coeff_t)1.,
+                     current.data() + r * L * nj, L, Aj.data(), mj,
+                     (coeff_t)0., next.data() + r * L * mj, L);
+    }
+    dims[j] = mj;
+    size = L * mj * R;
+    std::swap(current, next);
+  }
+  return current;
 }
 
 } // namespace lila
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include <lila/algebra/mult.h>
+#include <lila/arithmetic/add.h>
+#include <lila/matrix.h>
+#include <lila/special/special.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+namespace detail {
+
+// B = sum_{i=0}^{s-1} coeffs[offset + i] A^i with powers[i] = A^i, i >= 1
+template <class coeff_t>
+inline void poly_block(std::vector<coeff_t> const &coeffs, lila_size_t offset,
+                       std::vector<Matrix<coeff_t>> const &powers,
+                       Matrix<coeff_t> &B) {
+  std::fill(B.begin(), B.end(), coeff_t(0.));
+  lila_size_t s = powers.size();
+  lila_size_t ncoeffs = coeffs.size();
+  for (lila_size_t i = 0; (i < s) && (offset + i < ncoeffs); ++i) {
+    if (i == 0)
+      add_identity(coeffs[offset], B);
+    else if (coeffs[offset + i] != coeff_t(0.))
+      Add(powers[i], B, coeffs[offset + i]);
+  }
+}
+
+} // namespace detail
+
+// p(A) = sum_k coeffs[k] A^k with the Paterson-Stockmeyer scheme: with
+// s ~ sqrt(deg) the powers A^2, ..., A^s are formed once and p is evaluated
+// as a polynomial in A^s with matrix coefficients, using Horner's rule. This
+// needs about 2 sqrt(deg) instead of deg matrix multiplications. The Horner
+// steps alternate between two preallocated buffers.
+template <class coeff_t>
+inline Matrix<coeff_t> PolyEval(Matrix<coeff_t> const &A,
+                                std::vector<coeff_t> const &coeffs) {
+  lila_size_t n = A.nrows();
+  assert(n == A.ncols());
+  Matrix<coeff_t> P(n, n);
+  if (coeffs.empty() || (n == 0))
+    return P;
+
+  lila_size_t deg = coeffs.size() - 1;
+  lila_size_t s = (lila_size_t)std::ceil(std::sqrt((double)deg + 1));
+  s = std::max(std::min(s, deg), (lila_size_t)1);
+  lila_size_t r = deg / s;
+
+  // powers[i] = A^i for i = 1, ..., s (powers[0] is unused)
+  std::vector<Matrix<coeff_t>> powers(s + 1);
+  powers[1] = A;
+  for (lila_size_t i = 2; i <= s; ++i) {
+    powers[i] = Matrix<coeff_t>(n, n);
+    detail::gemm('N', 'N', n, n, n, coeff_t(1.), powers[i - 1].data(), n,
+                 A.data(), n, coeff_t(0.), powers[i].data(), n);
+  }
+  Matrix<coeff_t> As = std::move(powers[s]);
+  powers.pop_back();
+
+  // Horner in A^s: P = B_r, P = P A^s + B_j for j = r - 1, ..., 0
+  Matrix<coeff_t> T(n, n);
+  detail::poly_block(coeffs, r * s, powers, P);
+  for (lila_size_t j = r; j-- > 0;) {
+    detail::poly_block(coeffs, j * s, powers, T);
+    detail::gemm('N', 'N', n, n, n, coeff_t(1.), P.data(), n, As.data(), n,
+                 coeff_t(1.), T.data(), n);
+    swap(P, T);
+  }
+  return P;
+}
+
+// p(A) V for a Vector or a block of vectors V by Horner's rule,
+// Y = A Y + coeffs[k] V, which never forms p(A). The steps alternate
+// between two preallocated buffers.
+template <class coeff_t>
+inline Matrix<coeff_t> PolyEval(Matrix<coeff_t> const &A,
+                                std::vector<coeff_t> const &coeffs,
+                                Matrix<coeff_t> const &V) {
+  lila_size_t n = A.nrows();
+  lila_size_t k = V.ncols();
+  assert(n == A.ncols());
+  assert(n == V.nrows());
+  Matrix<coeff_t> Y(n, k);
+  if (coeffs.empty())
+    return Y;
+
+  Matrix<coeff_t> T(n, k);
+  Add(V, Y, coeffs.back());
+  for (lila_size_t d = coeffs.size() - 1; d-- > 0;) {
+    detail::gemm('N', 'N', n, k, n, coeff_t(1.), A.data(), n, Y.data(), n,
+                 coeff_t(0.), T.data(), n);
+    if (coeffs[d] != coeff_t(0.))
+      Add(V, T, coeffs[d]);
+    swap(Y, T);
+  }
+  return Y;
+}
+
+template <class coeff_t>
+inline Vector<coeff_t> PolyEval(Matrix<coeff_t> const &A,
+                                std::vector<coeff_t> const &coeffs,
+                                Vector<coeff_t> const &v) {
+  Matrix<coeff_t> V(v);
+  return Vector<coeff_t>(PolyEval(A, coeffs, V).vector());
+}
+
+} // namespace lila
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <vector>
+
+#include <lila/algebra/matrixfunction.h>
+#include <lila/algebra/mult.h>
+#include <lila/eigen/eigen_sym.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+// Eigendecomposition A = Q L Q^H of a Hermitian matrix which is computed
+// once and then used to evaluate f(A) or f(A) V for many functions f, e.g.
+// exp(t A) for many times t. Functions are called as f(x) on the (real)
+// eigenvalues x and return a coeff_t. Every evaluation of f(A) costs one
+// rank-k update or gemm, every evaluation of f(A) V with precomputed Q^H V
+// costs one gemm or gemv.
+template <class coeff_t> class SpectralDecomposition {
+public:
+  using real_type = real_t<coeff_t>;
+
+  SpectralDecomposition() = default;
+  explicit SpectralDecomposition(Matrix<coeff_t> const &A, char uplo = 'U')
+      : eigenvectors_(A) {
+    assert(A.nrows() == A.ncols());
+    eigenvalues_ = EigenSymInplace(eigenvectors_, true, uplo);
+  }
+
+  lila_size_t n() const { return eigenvalues_.size(); }
+  Vector<real_type> const &eigenvalues() const { return eigenvalues_; }
+  Matrix<coeff_t> const &eigenvectors() const { return eigenvectors_; }
+
+  // f(A)
+  template <class function_t> Matrix<coeff_t> apply(function_t f) const {
+    Matrix<coeff_t> res;
+    detail::spectral_reconstruct(eigenvectors_, fvals(f), res);
+    return res;
+  }
+
+  // f(A) v
+  template <class function_t>
+  Vector<coeff_t> apply(function_t f, Vector<coeff_t> const &v) const {
+    return apply_projected(f, project(v));
+  }
+
+  // f(A) V
+  template <class function_t>
+  Matrix<coeff_t> apply(function_t f, Matrix<coeff_t> const &V) const {
+    return apply_projected(f, project(V));
+  }
+
+  // f(p, A) for every parameter p, f is called as f(p, x)
+  template <class function_t, class param_t>
+  std::vector<Matrix<coeff_t>> apply(function_t f,
+                                     std::vector<param_t> const &params) const {
+    std::vector<Matrix<coeff_t>> res;
+    res.reserve(params.size());
+    for (auto const &p : params)
+      res.push_back(apply([&f, &p](real_type x) { return f(p, x); }));
+    return res;
+  }
+
+  // f(p, A) V for every parameter p, Q^H V is only computed once
+  template <class function_t, class param_t, class vec_t>
+  std::vector<vec_t> apply(function_t f, std::vector<param_t> const &params,
+                           vec_t const &V) const {
+    auto W = project(V);
+    std::vector<vec_t> res;
+    res.reserve(params.size());
+    for (auto const &p : params)
+      res.push_back(
+          apply_projected([&f, &p](real_type x) { return f(p, x); }, W));
+    return res;
+  }
+
+  // exp(t A), exp(t A) V and their batched versions
+  Matrix<coeff_t> exp(coeff_t t) const {
+    return apply([t](real_type x) { return std::exp(t * x); });
+  }
+
+  template <class vec_t> vec_t exp(coeff_t t, vec_t const &V) const {
+    return apply([t](real_type x) { return std::exp(t * x); }, V);
+  }
+
+  std::vector<Matrix<coeff_t>> exp(std::vector<coeff_t> const &ts) const {
+    return apply([](coeff_t t, real_type x) { return std::exp(t * x); }, ts);
+  }
+
+  template <class vec_t>
+  std::vector<vec_t> exp(std::vector<coeff_t> const &ts,
+                         vec_t const &V) const {
+    return apply([](coeff_t t, real_type x) { return std::exp(t * x); }, ts,
+                 V);
+  }
+
+private:
+  Vector<real_type> eigenvalues_;
+  Matrix<coeff_t> eigenvectors_;
+
+  template <class function_t>
+  std::vector<coeff_t> fvals(function_t f) const {
+    std::vector<coeff_t> res(n());
+    for (lila_size_t i = 0; i < n(); ++i)
+      res[i] = static_cast<coeff_t>(f(eigenvalues_(i)));
+    return res;
+  }
+
+  // Q^H V
+  Vector<coeff_t> project(Vector<coeff_t> const &v) const {
+    Vector<coeff_t> w;
+    Mult(eigenvectors_, v, w, coeff_t(1.), coeff_t(0.), 'C');
+    return w;
+  }
+
+  Matrix<coeff_t> project(Matrix<coeff_t> const &V) const {
+    Matrix<coeff_t> W;
+    Mult(eigenvectors_, V, W, coeff_t(1.), coeff_t(0.), 'C', 'N');
+    return W;
+  }
+
+  // Q f(L) W
+  template <class function_t>
+  Vector<coeff_t> apply_projected(function_t f,
+                                  Vector<coeff_t> const &w) const {
+    auto fw = w;
+    for (lila_size_t i = 0; i < n(); ++i)
+      fw(i) *= static_cast<coeff_t>(f(eigenvalues_(i)));
+    Vector<coeff_t> res;
+    Mult(eigenvectors_, fw, res);
+    return res;
+  }
+
+  template <class function_t>
+  Matrix<coeff_t> apply_projected(function_t f,
+                                  Matrix<coeff_t> const &W) const {
+    auto f_of_eigs = fvals(f);
+    auto fW = W;
+    for (lila_size_t j = 0; j < W.ncols(); ++j)
+      for (lila_size_t i = 0; i < n(); ++i)
+        fW(i, j) *= f_of_eigs[i];
+    Matrix<coeff_t> res;
+    Mult(eigenvectors_, fW, res);
+    return res;
+  }
+};
+
+} // namespace lila
@@ -7,6 +7,7 @@
 #include "common.h"
 #include "vector.h"
 #include "matrix.h"
+#include "views/real_imag_view.h"
 
 #include "numeric/compare.h"
 #include "numeric/complex.h"
@@ -15,21 +16,40 @@
 #include "arithmetic/add.h"
 #include "arithmetic/copy.h"
 #include "arithmetic/dot.h"
+#include "arithmetic/hadamard.h"
 #include "arithmetic/map.h"
 #include "arithmetic/norm.h"
 #include "arithmetic/scale.h"
 
 #include "algebra/mult.h"
 #include "algebra/expm.h"
+#include "algebra/expmv.h"
+#include "algebra/lanczos_propagator.h"
+#include "algebra/chebyshev.h"
+#include "algebra/kpm.h"
+#include "algebra/matrix_iterations.h"
+#include "algebra/polynomial.h"
 #include "algebra/matrixfunction.h"
+#include "algebra/spectral_decomposition.h"
 
 #include "special/random.h"
 #include "special/special.h"
 #include "special/matrix_ops.h"
 
+#include "split/split_complex.h"
+#include "split/split_arithmetic.h"
+
 #include "decomp/solve.h"
 #include "decomp/cholesky.h"
 #include "decomp/determinant.h"
+#include "decomp/lu.h"
+#include "decomp/ldlt.h"
+#include "decomp/low_rank_update.h"
+#include "decomp/pfaffian.h"
+#include "decomp/svd.h"
+#include "decomp/tsqr.h"
+#include "decomp/least_squares.h"
+#include "decomp/incremental_qr.h"
 
 #include "eigen/eigen.h"
 #include "eigen/eigen_sym.h"
@@ -0,0 +1,227 @@
+#pragma once
+
+#include <cassert>
+#include <type_traits>
+
+#include <lila/common.h>
+#include <lila/matrix.h>
+#include <lila/vector.h>
+#include <lila/views/matrix_view.h>
+#include <lila/views/vector_view.h>
+
+namespace lila {
+
+// Element-wise (Hadamard) products, quotients and fused multiply-adds.
+// The three operands may be any combination of Vector/VectorView (or
+// Matrix/MatrixView) and their coefficient types may differ, e.g. a complex
+// state vector times a real diagonal is computed as complex * real without
+// promoting the diagonal to complex. The output may alias an input.
+
+namespace detail {
+
+template <class T> struct is_vector_like : std::false_type {};
+template <class T> struct is_vector_like<Vector<T>> : std::true_type {};
+template <class T> struct is_vector_like<VectorView<T>> : std::true_type {};
+
+template <class T> struct is_matrix_like : std::false_type {};
+template <class T> struct is_matrix_like<Matrix<T>> : std::true_type {};
+template <class T> struct is_matrix_like<MatrixView<T>> : std::true_type {};
+
+template <class... Ts>
+constexpr bool all_vector_like =
+    (is_vector_like<std::remove_cv_t<std::remove_reference_t<Ts>>>::value &&
+     ...);
+template <class... Ts>
+constexpr bool all_matrix_like =
+    (is_matrix_like<std::remove_cv_t<std::remove_reference_t<Ts>>>::value &&
+     ...);
+
+template <class T>
+inline VectorView<T> as_view(Vector<T> const &v) {
+  return VectorView<T>(v);
+}
+template <class T> inline VectorView<T> as_view(VectorView<T> const &v) {
+  return v;
+}
+template <class T>
+inline MatrixView<T> as_view(Matrix<T> const &A) {
+  return MatrixView<T>(A);
+}
+template <class T> inline MatrixView<T> as_view(MatrixView<T> const &A) {
+  return A;
+}
+
+// z[i] = op(x[i], y[i], z[i]) on strided arrays, an increment of zero
+// broadcasts a single value
+template <class x_t, class y_t, class z_t, class op_t>
+inline void elementwise(lila_size_t n, x_t const *x, lila_size_t incx,
+                        y_t const *y, lila_size_t incy, z_t *z,
+                        lila_size_t incz, op_t op) {
+  if ((incx == 1) && (incy == 1) && (incz == 1)) {
+    LILA_OMP(omp parallel for simd if (n >= parallel_min_size))
+    for (lila_size_t i = 0; i < n; ++i)
+      op(x[i], y[i], z[i]);
+  } else {
+    LILA_OMP(omp parallel for if (n >= parallel_min_size))
+    for (lila_size_t i = 0; i < n; ++i)
+      op(x[i * incx], y[i * incy], z[i * incz]);
+  }
+}
+
+template <class x_t, class y_t, class z_t, class op_t>
+inline void elementwise(VectorView<x_t> const &x, VectorView<y_t> const &y,
+                        VectorView<z_t> z, op_t op) {
+  assert(x.n() == y.n());
+  assert(x.n() == z.n());
+  elementwise(x.n(), x.data(), x.inc(), y.data(), y.inc(), z.data(), z.inc(),
+              op);
+}
+
+template <class T> inline bool is_contiguous(MatrixView<T> const &A) {
+  return (A.incm() == 1) && (A.incn() == 1) && (A.ld() == A.m());
+}
+
+template <class x_t, class y_t, class z_t, class op_t>
+inline void elementwise(MatrixView<x_t> const &x, MatrixView<y_t> const &y,
+                        MatrixView<z_t> z, op_t op) {
+  assert((x.m() == y.m()) && (x.n() == y.n()));
+  assert((x.m() == z.m()) && (x.n() == z.n()));
+  if (is_contiguous(x) && is_contiguous(y) && is_contiguous(z)) {
+    elementwise(x.size(), x.data(), 1, y.data(), 1, z.data(), 1, op);
+  } else {
+    lila_size_t m = x.m();
+    lila_size_t n = x.n();
+    LILA_OMP(omp parallel for if (m * n >= parallel_min_size))
+    for (lila_size_t col = 0; col < n; ++col)
+      elementwise(m, x.data() + col * x.incn() * x.ld(), x.incm(),
+                  y.data() + col * y.incn() * y.ld(), y.incm(),
+                  z.data() + col * z.incn() * z.ld(), z.incm(), op);
+  }
+}
+
+// x * y, for two complex numbers by the explicit formula on the real and
+// imaginary parts. The std::complex operator* calls __muldc3 to recover
+// from NaN results, which keeps the loops from vectorizing.
+template <class x_t, class y_t>
+inline auto hadamard_product(x_t const &x, y_t const &y) {
+  if constexpr (is_complex<x_t>() && is_complex<y_t>()) {
+    using z_t = decltype(x * y);
+    return z_t(x.real() * y.real() - x.imag() * y.imag(),
+               x.real() * y.imag() + x.imag() * y.real());
+  } else {
+    return x * y;
+  }
+}
+
+struct hadamard_mult_op {
+  template <class x_t, class y_t, class z_t>
+  void operator()(x_t const &x, y_t const &y, z_t &z) const {
+    z = hadamard_product(x, y);
+  }
+};
+
+struct hadamard_div_op {
+  template <class x_t, class y_t, class z_t>
+  void operator()(x_t const &x, y_t const &y, z_t &z) const {
+    z = x / y;
+  }
+};
+
+struct hadamard_fma_op {
+  template <class x_t, class y_t, class z_t>
+  void operator()(x_t const &x, y_t const &y, z_t &z) const {
+    z += hadamard_product(x, y);
+  }
+};
+
+} // namespace detail
+
+// z = x * y (element-wise)
+template <class x_t, class y_t, class z_t,
+          std::enable_if_t<detail::all_vector_like<x_t, y_t, z_t> ||
+                               detail::all_matrix_like<x_t, y_t, z_t>,
+                           int> = 0>
+inline void HadamardMult(x_t const &x, y_t const &y, z_t &&z) {
+  detail::elementwise(detail::as_view(x), detail::as_view(y),
+                      detail::as_view(z), detail::hadamard_mult_op());
+}
+
+// z = x / y (element-wise)
+template <class x_t, class y_t, class z_t,
+          std::enable_if_t<detail::all_vector_like<x_t, y_t, z_t> ||
+                               detail::all_matrix_like<x_t, y_t, z_t>,
+                           int> = 0>
+inline void HadamardDiv(x_t const &x, y_t const &y, z_t &&z) {
+  detail::elementwise(detail::as_view(x), detail::as_view(y),
+                      detail::as_view(z), detail::hadamard_div_op());
+}
+
+// z = x * y + z (element-wise)
+template <class x_t, class y_t, class z_t,
+          std::enable_if_t<detail::all_vector_like<x_t, y_t, z_t> ||
+                               detail::all_matrix_like<x_t, y_t, z_t>,
+                           int> = 0>
+inline void HadamardFma(x_t const &x, y_t const &y, z_t &&z) {
+  detail::elementwise(detail::as_view(x), detail::as_view(y),
+                      detail::as_view(z), detail::hadamard_fma_op());
+}
+
+template <class x_t, class y_t,
+          std::enable_if_t<detail::all_vector_like<x_t, y_t>, int> = 0>
+inline auto HadamardMult(x_t const &x, y_t const &y) {
+  using coeff_t = decltype(*detail::as_view(x).data() *
+                           *detail::as_view(y).data());
+  Vector<std::decay_t<coeff_t>> z(x.n());
+  HadamardMult(x, y, z);
+  return z;
+}
+
+template <class x_t, class y_t,
+          std::enable_if_t<detail::all_matrix_like<x_t, y_t>, int> = 0>
+inline auto HadamardMult(x_t const &x, y_t const &y) {
+  using coeff_t = decltype(*detail::as_view(x).data() *
+                           *detail::as_view(y).data());
+  Matrix<std::decay_t<coeff_t>> z(x.m(), x.n());
+  HadamardMult(x, y, z);
+  return z;
+}
+
+// A = diag(d) * A, i.e. row i of A is scaled by d(i)
+template <class d_t, class A_t,
+          std::enable_if_t<detail::all_vector_like<d_t> &&
+                               detail::all_matrix_like<A_t>,
+                           int> = 0>
+inline void ScaleRows(d_t const &d, A_t &&A) {
+  auto dv = detail::as_view(d);
+  auto Av = detail::as_view(A);
+  assert(dv.n() == Av.m());
+  lila_size_t m = Av.m();
+  lila_size_t n = Av.n();
+  LILA_OMP(omp parallel for if (m * n >= parallel_min_size))
+  for (lila_size_t col = 0; col < n; ++col) {
+    auto Acol = Av.data() + col * Av.incn() * Av.ld();
+    detail::elementwise(m, dv.data(), dv.inc(), Acol, Av.incm(), Acol,
+                        Av.incm(), detail::hadamard_mult_op());
+  }
+}
+
+// A = A * diag(d), i.e. column j of A is scaled by d(j)
+template <class d_t, class A_t,
+          std::enable_if_t<detail::all_vector_like<d_t> &&
+                               detail::all_matrix_like<A_t>,
+                           int> = 0>
+inline void ScaleCols(d_t const &d, A_t &&A) {
+  auto dv = detail::as_view(d);
+  auto Av = detail::as_view(A);
+  assert(dv.n() == Av.n());
+  lila_size_t m = Av.m();
+  lila_size_t n = Av.n();
+  LILA_OMP(omp parallel for if (m * n >= parallel_min_size))
+  for (lila_size_t col = 0; col < n; ++col) {
+    auto Acol = Av.data() + col * Av.incn() * Av.ld();
+    detail::elementwise(m, dv.data() + col * dv.inc(), 0, Acol, Av.incm(),
+                        Acol, Av.incm(), detail::hadamard_mult_op());
+  }
+}
+
+} // namespace lila
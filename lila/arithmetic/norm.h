@@ -1,6 +1,8 @@
 #pragma once
 
+#include <algorithm>
 #include <cassert>
+#include <cmath>
 
 #include <lila/arithmetic/scale.h>
 #include <lila/blaslapack/blaslapack.h>
@@ -44,23 +46,51 @@ inline real_t<coeff_t> Norm(MatrixView<coeff_t> const &A) {
   return std::sqrt(norm);
 }
 
+// Maximum absolute row sum
+template <class coeff_t>
+inline real_t<coeff_t> NormLi(Matrix<coeff_t> const &X) {
+  real_t<coeff_t> value = 0.0;
+  for (lila_size_t i = 0; i < X.nrows(); i++) {
+    real_t<coeff_t> row_sum = 0.0;
+    for (lila_size_t j = 0; j < X.ncols(); j++) {
+      row_sum += std::abs(X(i, j));
+    }
+    value = std::max(value, row_sum);
+  }
+  return value;
+}
+
+// Maximum absolute column sum
+template <class coeff_t>
+inline real_t<coeff_t> Norm1(Matrix<coeff_t> const &X) {
+  real_t<coeff_t> value = 0.0;
+  for (lila_size_t j = 0; j < X.ncols(); j++) {
+    real_t<coeff_t> col_sum = 0.0;
+    for (lila_size_t i = 0; i < X.nrows(); i++) {
+      col_sum += std::abs(X(i, j));
+    }
+    value = std::max(value, col_sum);
+  }
+  return value;
+}
+
 template <class coeff_t> inline void Normalize(Vector<coeff_t> &v) {
-  coeff_t norm = Norm(v);
+  real_t<coeff_t> norm = Norm(v);
   v /= norm;
 }
 
 template <class coeff_t> inline void Normalize(VectorView<coeff_t> &v) {
-  coeff_t norm = Norm(v);
+  real_t<coeff_t> norm = Norm(v);
   v /= norm;
 }
 
 template <class coeff_t> inline void Normalize(Matrix<coeff_t> &A) {
-  coeff_t norm = Norm(A);
+  real_t<coeff_t> norm = Norm(A);
   A /= norm;
 }
 
 template <class coeff_t> inline void Normalize(MatrixView<coeff_t> &A) {
-  coeff_t norm = Norm(A);
+  real_t<coeff_t> norm = Norm(A);
   A /= norm;
 }
 
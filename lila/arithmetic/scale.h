@@ -113,7 +113,7 @@ operator*(VectorView<std::complex<coeff_t>> v, coeff_t alpha) {
 template <class coeff_t>
 inline Vector<coeff_t> operator/(Vector<coeff_t> const &v, coeff_t alpha) {
   Vector<coeff_t> res(v);
-  Scale(1. / alpha, res);
+  Scale(static_cast<coeff_t>(1.) / alpha, res);
   return res;
 }
 
@@ -128,7 +128,7 @@ operator/(Vector<std::complex<coeff_t>> const &v, coeff_t alpha) {
 template <class coeff_t>
 inline Vector<coeff_t> operator/(VectorView<coeff_t> v, coeff_t alpha) {
   Vector<coeff_t> res(v);
-  Scale(1. / alpha, res);
+  Scale(static_cast<coeff_t>(1.) / alpha, res);
   return res;
 }
 
@@ -168,7 +168,7 @@ operator*=(VectorView<std::complex<coeff_t>> X, coeff_t alpha) {
 
 template <class coeff_t>
 inline Vector<coeff_t> &operator/=(Vector<coeff_t> &X, coeff_t alpha) {
-  Scale(1. / alpha, X);
+  Scale(static_cast<coeff_t>(1.) / alpha, X);
   return X;
 }
 
@@ -181,7 +181,7 @@ operator/=(Vector<std::complex<coeff_t>> &X, coeff_t alpha) {
 
 template <class coeff_t>
 inline VectorView<coeff_t> operator/=(VectorView<coeff_t> X, coeff_t alpha) {
-  Scale(1. / alpha, X);
+  Scale(static_cast<coeff_t>(1.) / alpha, X);
   return X;
 }
 
@@ -257,7 +257,7 @@ operator*(MatrixView<std::complex<coeff_t>> v, coeff_t alpha) {
 template <class coeff_t>
 inline Matrix<coeff_t> operator/(Matrix<coeff_t> const &v, coeff_t alpha) {
   Matrix<coeff_t> res(v);
-  Scale(1. / alpha, res);
+  Scale(static_cast<coeff_t>(1.) / alpha, res);
   return res;
 }
 
@@ -272,7 +272,7 @@ operator/(Matrix<std::complex<coeff_t>> const &v, coeff_t alpha) {
 template <class coeff_t>
 inline Matrix<coeff_t> operator/(MatrixView<coeff_t> v, coeff_t alpha) {
   Matrix<coeff_t> res(v);
-  Scale(1. / alpha, res);
+  Scale(static_cast<coeff_t>(1.) / alpha, res);
   return res;
 }
 
@@ -312,7 +312,7 @@ operator*=(MatrixView<std::complex<coeff_t>> X, coeff_t alpha) {
 
 template <class coeff_t>
 inline Matrix<coeff_t> &operator/=(Matrix<coeff_t> &X, coeff_t alpha) {
-  Scale(1. / alpha, X);
+  Scale(static_cast<coeff_t>(1.) / alpha, X);
   return X;
 }
 
@@ -325,7 +325,7 @@ operator/=(Matrix<std::complex<coeff_t>> &X, coeff_t alpha) {
 
 template <class coeff_t>
 inline MatrixView<coeff_t> operator/=(MatrixView<coeff_t> X, coeff_t alpha) {
-  Scale(1. / alpha, X);
+  Scale(static_cast<coeff_t>(1.) / alpha, X);
   return X;
 }
 
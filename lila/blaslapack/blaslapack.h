@@ -262,6 +262,48 @@ inline void gemv(__LILA_BLAS_LAPACK_CONST char *trans,
   (trans, m, n, alpha, A, dima, x, incx, beta, y, incy);
 }
 
+// Ger / Geru (unconjugated rank-1 update)
+inline void ger(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                __LILA_BLAS_LAPACK_CONST blas_float_t *x,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                __LILA_BLAS_LAPACK_CONST blas_float_t *y,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *incy, blas_float_t *A,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *lda) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(sger)(m, n, alpha, x, incx, y, incy, A, lda);
+}
+inline void ger(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                __LILA_BLAS_LAPACK_CONST blas_double_t *x,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                __LILA_BLAS_LAPACK_CONST blas_double_t *y,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *incy, blas_double_t *A,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *lda) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dger)(m, n, alpha, x, incx, y, incy, A, lda);
+}
+inline void ger(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                __LILA_BLAS_LAPACK_CONST blas_scomplex_t *x,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                __LILA_BLAS_LAPACK_CONST blas_scomplex_t *y,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *incy, blas_scomplex_t *A,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *lda) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cgeru)(m, n, alpha, x, incx, y, incy, A, lda);
+}
+inline void ger(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                __LILA_BLAS_LAPACK_CONST blas_complex_t *x,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                __LILA_BLAS_LAPACK_CONST blas_complex_t *y,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *incy, blas_complex_t *A,
+                __LILA_BLAS_LAPACK_CONST blas_size_t *lda) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zgeru)(m, n, alpha, x, incx, y, incy, A, lda);
+}
+
 // Gemm
 inline void gemm(__LILA_BLAS_LAPACK_CONST char *transa,
                  __LILA_BLAS_LAPACK_CONST char *transb,
@@ -326,6 +368,306 @@ inline void gemm(__LILA_BLAS_LAPACK_CONST char *transa,
   (transa, transb, m, n, k, alpha, A, dima, B, dimb, beta, C, dimc);
 }
 
+// Syrk / Herk
+inline void syrk(__LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *trans,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *beta, blas_float_t *C,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldc) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ssyrk)
+  (uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+inline void syrk(__LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *trans,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *beta, blas_double_t *C,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldc) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dsyrk)
+  (uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+inline void herk(__LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *trans,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *beta,
+                 blas_scomplex_t *C,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldc) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cherk)
+  (uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+inline void herk(__LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *trans,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *beta,
+                 blas_complex_t *C,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldc) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zherk)
+  (uplo, trans, n, k, alpha, A, lda, beta, C, ldc);
+}
+
+// Symm / Hemm
+inline void symm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *beta, blas_float_t *C,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldc) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ssymm)
+  (side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+inline void symm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *beta, blas_double_t *C,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldc) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dsymm)
+  (side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+inline void symm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *beta,
+                 blas_scomplex_t *C,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldc) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(csymm)
+  (side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+inline void symm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *beta,
+                 blas_complex_t *C, __LILA_BLAS_LAPACK_CONST blas_size_t *ldc) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zsymm)
+  (side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+inline void hemm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *beta,
+                 blas_scomplex_t *C,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldc) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(chemm)
+  (side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+inline void hemm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *beta,
+                 blas_complex_t *C, __LILA_BLAS_LAPACK_CONST blas_size_t *ldc) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zhemm)
+  (side, uplo, m, n, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// Trmm
+inline void trmm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *transa,
+                 __LILA_BLAS_LAPACK_CONST char *diag,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(strmm)
+  (side, uplo, transa, diag, m, n, alpha, A, lda, B, ldb);
+}
+inline void trmm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *transa,
+                 __LILA_BLAS_LAPACK_CONST char *diag,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dtrmm)
+  (side, uplo, transa, diag, m, n, alpha, A, lda, B, ldb);
+}
+inline void trmm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *transa,
+                 __LILA_BLAS_LAPACK_CONST char *diag,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_scomplex_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ctrmm)
+  (side, uplo, transa, diag, m, n, alpha, A, lda, B, ldb);
+}
+inline void trmm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *transa,
+                 __LILA_BLAS_LAPACK_CONST char *diag,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_complex_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ztrmm)
+  (side, uplo, transa, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+// Trsm
+inline void trsm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *transa,
+                 __LILA_BLAS_LAPACK_CONST char *diag,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(strsm)
+  (side, uplo, transa, diag, m, n, alpha, A, lda, B, ldb);
+}
+inline void trsm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *transa,
+                 __LILA_BLAS_LAPACK_CONST char *diag,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dtrsm)
+  (side, uplo, transa, diag, m, n, alpha, A, lda, B, ldb);
+}
+inline void trsm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *transa,
+                 __LILA_BLAS_LAPACK_CONST char *diag,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_scomplex_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ctrsm)
+  (side, uplo, transa, diag, m, n, alpha, A, lda, B, ldb);
+}
+inline void trsm(__LILA_BLAS_LAPACK_CONST char *side,
+                 __LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST char *transa,
+                 __LILA_BLAS_LAPACK_CONST char *diag,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_complex_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ztrsm)
+  (side, uplo, transa, diag, m, n, alpha, A, lda, B, ldb);
+}
+
+// Symv / Hemv
+inline void symv(__LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *x,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                 __LILA_BLAS_LAPACK_CONST blas_float_t *beta, blas_float_t *y,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *incy) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ssymv)
+  (uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+inline void symv(__LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *x,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                 __LILA_BLAS_LAPACK_CONST blas_double_t *beta, blas_double_t *y,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *incy) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dsymv)
+  (uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+inline void hemv(__LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *x,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                 __LILA_BLAS_LAPACK_CONST blas_scomplex_t *beta,
+                 blas_scomplex_t *y,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *incy) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(chemv)
+  (uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+inline void hemv(__LILA_BLAS_LAPACK_CONST char *uplo,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *x,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                 __LILA_BLAS_LAPACK_CONST blas_complex_t *beta,
+                 blas_complex_t *y,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *incy) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zhemv)
+  (uplo, n, alpha, A, lda, x, incx, beta, y, incy);
+}
+
 //////////////////////////
 // Linear Solve
 // Gesv
@@ -358,6 +700,37 @@ inline void gesv(__LILA_BLAS_LAPACK_CONST blas_size_t *n,
   __LILA_BLAS_LAPACK_ROUTINE_NAME(zgesv)(n, n_rhs, A, lda, ipiv, B, ldb, info);
 }
 
+// Gesv with single precision factorization and iterative refinement
+inline void gesv_mixed(__LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                       blas_double_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       blas_size_t *ipiv,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                       blas_double_t *X,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldx,
+                       blas_double_t *work, blas_float_t *swork,
+                       blas_size_t *iter, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dsgesv)
+  (n, n_rhs, A, lda, ipiv, B, ldb, X, ldx, work, swork, iter, info);
+}
+inline void gesv_mixed(__LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                       blas_complex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       blas_size_t *ipiv,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                       blas_complex_t *X,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldx,
+                       blas_complex_t *work, blas_scomplex_t *swork,
+                       blas_double_t *rwork, blas_size_t *iter,
+                       blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zcgesv)
+  (n, n_rhs, A, lda, ipiv, B, ldb, X, ldx, work, swork, rwork, iter, info);
+}
+
 //////////////////////////
 // LU Decomposition
 // Getrf (performs LU Decomposition)
@@ -548,6 +921,68 @@ inline void orgqr(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
   (m, n, k, A, lda, tau, work, lwork, info);
 }
 
+// Ormqr / Unmqr (multiplies by the matrix Q of the QR Decomposition)
+// (Note: use ormqr also for the complex routines xunmqr)
+inline void ormqr(__LILA_BLAS_LAPACK_CONST char *side,
+                  __LILA_BLAS_LAPACK_CONST char *trans,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *tau, blas_float_t *C,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldc, blas_float_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(sormqr)
+  (side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+}
+inline void ormqr(__LILA_BLAS_LAPACK_CONST char *side,
+                  __LILA_BLAS_LAPACK_CONST char *trans,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *tau, blas_double_t *C,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldc,
+                  blas_double_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dormqr)
+  (side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+}
+inline void ormqr(__LILA_BLAS_LAPACK_CONST char *side,
+                  __LILA_BLAS_LAPACK_CONST char *trans,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                  __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_scomplex_t *tau,
+                  blas_scomplex_t *C, __LILA_BLAS_LAPACK_CONST blas_size_t *ldc,
+                  blas_scomplex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cunmqr)
+  (side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+}
+inline void ormqr(__LILA_BLAS_LAPACK_CONST char *side,
+                  __LILA_BLAS_LAPACK_CONST char *trans,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                  __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_complex_t *tau,
+                  blas_complex_t *C, __LILA_BLAS_LAPACK_CONST blas_size_t *ldc,
+                  blas_complex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zunmqr)
+  (side, trans, m, n, k, A, lda, tau, C, ldc, work, lwork, info);
+}
+
 //////////////////////////
 // Cholesky Decomposition
 inline void potrf(__LILA_BLAS_LAPACK_CONST char *uplo,
@@ -578,6 +1013,566 @@ inline void potrf(__LILA_BLAS_LAPACK_CONST char *uplo,
   __LILA_BLAS_LAPACK_ROUTINE_NAME(zpotrf)(uplo, n, A, lda, info);
 }
 
+// Potrs (solves system of equations from Cholesky Decomposition)
+inline void potrs(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *B,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(spotrs)(uplo, n, n_rhs, A, lda, B, ldb, info);
+}
+inline void potrs(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *B,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dpotrs)(uplo, n, n_rhs, A, lda, B, ldb, info);
+}
+inline void potrs(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                  __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_scomplex_t *B,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cpotrs)(uplo, n, n_rhs, A, lda, B, ldb, info);
+}
+inline void potrs(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                  __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_complex_t *B,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zpotrs)(uplo, n, n_rhs, A, lda, B, ldb, info);
+}
+
+// Potri (computes inverse from Cholesky Decomposition)
+inline void potri(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(spotri)(uplo, n, A, lda, info);
+}
+inline void potri(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dpotri)(uplo, n, A, lda, info);
+}
+inline void potri(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cpotri)(uplo, n, A, lda, info);
+}
+inline void potri(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zpotri)(uplo, n, A, lda, info);
+}
+
+//////////////////////////
+// LDL^T Decomposition (Bunch-Kaufman)
+// Sytrf / Hetrf
+inline void sytrf(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_size_t *ipiv,
+                  blas_float_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ssytrf)
+  (uplo, n, A, lda, ipiv, work, lwork, info);
+}
+inline void sytrf(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_size_t *ipiv,
+                  blas_double_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dsytrf)
+  (uplo, n, A, lda, ipiv, work, lwork, info);
+}
+inline void hetrf(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_size_t *ipiv,
+                  blas_scomplex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(chetrf)
+  (uplo, n, A, lda, ipiv, work, lwork, info);
+}
+inline void hetrf(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_size_t *ipiv,
+                  blas_complex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zhetrf)
+  (uplo, n, A, lda, ipiv, work, lwork, info);
+}
+
+// Sytrs / Hetrs
+inline void sytrs(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv, blas_float_t *B,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ssytrs)
+  (uplo, n, n_rhs, A, lda, ipiv, B, ldb, info);
+}
+inline void sytrs(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv, blas_double_t *B,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dsytrs)
+  (uplo, n, n_rhs, A, lda, ipiv, B, ldb, info);
+}
+inline void hetrs(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                  __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                  blas_scomplex_t *B, __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(chetrs)
+  (uplo, n, n_rhs, A, lda, ipiv, B, ldb, info);
+}
+inline void hetrs(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                  __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv, blas_complex_t *B,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zhetrs)
+  (uplo, n, n_rhs, A, lda, ipiv, B, ldb, info);
+}
+
+// Sytri / Hetri
+inline void sytri(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                  blas_float_t *work, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ssytri)(uplo, n, A, lda, ipiv, work, info);
+}
+inline void sytri(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                  blas_double_t *work, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dsytri)(uplo, n, A, lda, ipiv, work, info);
+}
+inline void hetri(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                  blas_scomplex_t *work, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(chetri)(uplo, n, A, lda, ipiv, work, info);
+}
+inline void hetri(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                  blas_complex_t *work, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zhetri)(uplo, n, A, lda, ipiv, work, info);
+}
+
+//////////////////////////
+// Condition number estimates
+// Gecon (from LU Decomposition)
+inline void gecon(__LILA_BLAS_LAPACK_CONST char *norm,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                  blas_float_t *rcond, blas_float_t *work, blas_size_t *iwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(sgecon)
+  (norm, n, A, lda, anorm, rcond, work, iwork, info);
+}
+inline void gecon(__LILA_BLAS_LAPACK_CONST char *norm,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                  blas_double_t *rcond, blas_double_t *work, blas_size_t *iwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dgecon)
+  (norm, n, A, lda, anorm, rcond, work, iwork, info);
+}
+inline void gecon(__LILA_BLAS_LAPACK_CONST char *norm,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                  blas_float_t *rcond, blas_scomplex_t *work,
+                  blas_float_t *rwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cgecon)
+  (norm, n, A, lda, anorm, rcond, work, rwork, info);
+}
+inline void gecon(__LILA_BLAS_LAPACK_CONST char *norm,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                  blas_double_t *rcond, blas_complex_t *work,
+                  blas_double_t *rwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zgecon)
+  (norm, n, A, lda, anorm, rcond, work, rwork, info);
+}
+
+// Pocon (from Cholesky Decomposition)
+inline void pocon(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                  blas_float_t *rcond, blas_float_t *work, blas_size_t *iwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(spocon)
+  (uplo, n, A, lda, anorm, rcond, work, iwork, info);
+}
+inline void pocon(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                  blas_double_t *rcond, blas_double_t *work, blas_size_t *iwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dpocon)
+  (uplo, n, A, lda, anorm, rcond, work, iwork, info);
+}
+inline void pocon(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                  blas_float_t *rcond, blas_scomplex_t *work,
+                  blas_float_t *rwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cpocon)
+  (uplo, n, A, lda, anorm, rcond, work, rwork, info);
+}
+inline void pocon(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                  blas_double_t *rcond, blas_complex_t *work,
+                  blas_double_t *rwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zpocon)
+  (uplo, n, A, lda, anorm, rcond, work, rwork, info);
+}
+
+// Sycon / Hecon (from LDL^T Decomposition)
+inline void sycon(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                  blas_float_t *rcond, blas_float_t *work, blas_size_t *iwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ssycon)
+  (uplo, n, A, lda, ipiv, anorm, rcond, work, iwork, info);
+}
+inline void sycon(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                  blas_double_t *rcond, blas_double_t *work, blas_size_t *iwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dsycon)
+  (uplo, n, A, lda, ipiv, anorm, rcond, work, iwork, info);
+}
+inline void hecon(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                  blas_float_t *rcond, blas_scomplex_t *work,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(checon)
+  (uplo, n, A, lda, ipiv, anorm, rcond, work, info);
+}
+inline void hecon(__LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                  blas_double_t *rcond, blas_complex_t *work,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zhecon)
+  (uplo, n, A, lda, ipiv, anorm, rcond, work, info);
+}
+
+//////////////////////////
+// Singular value decomposition
+// Gesdd (divide and conquer)
+inline void gesdd(__LILA_BLAS_LAPACK_CONST char *jobz,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *s,
+                  blas_float_t *U, __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                  blas_float_t *VT, __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                  blas_float_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *iwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(sgesdd)
+  (jobz, m, n, A, lda, s, U, ldu, VT, ldvt, work, lwork, iwork, info);
+}
+inline void gesdd(__LILA_BLAS_LAPACK_CONST char *jobz,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *s,
+                  blas_double_t *U, __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                  blas_double_t *VT, __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                  blas_double_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *iwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dgesdd)
+  (jobz, m, n, A, lda, s, U, ldu, VT, ldvt, work, lwork, iwork, info);
+}
+inline void gesdd(__LILA_BLAS_LAPACK_CONST char *jobz,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *s,
+                  blas_scomplex_t *U, __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                  blas_scomplex_t *VT,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                  blas_scomplex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_float_t *rwork, blas_size_t *iwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cgesdd)
+  (jobz, m, n, A, lda, s, U, ldu, VT, ldvt, work, lwork, rwork, iwork, info);
+}
+inline void gesdd(__LILA_BLAS_LAPACK_CONST char *jobz,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *s,
+                  blas_complex_t *U, __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                  blas_complex_t *VT,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                  blas_complex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_double_t *rwork, blas_size_t *iwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zgesdd)
+  (jobz, m, n, A, lda, s, U, ldu, VT, ldvt, work, lwork, rwork, iwork, info);
+}
+
+// Gesvd (QR iteration)
+inline void gesvd(__LILA_BLAS_LAPACK_CONST char *jobu,
+                  __LILA_BLAS_LAPACK_CONST char *jobvt,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *s,
+                  blas_float_t *U, __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                  blas_float_t *VT, __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                  blas_float_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(sgesvd)
+  (jobu, jobvt, m, n, A, lda, s, U, ldu, VT, ldvt, work, lwork, info);
+}
+inline void gesvd(__LILA_BLAS_LAPACK_CONST char *jobu,
+                  __LILA_BLAS_LAPACK_CONST char *jobvt,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *s,
+                  blas_double_t *U, __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                  blas_double_t *VT, __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                  blas_double_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dgesvd)
+  (jobu, jobvt, m, n, A, lda, s, U, ldu, VT, ldvt, work, lwork, info);
+}
+inline void gesvd(__LILA_BLAS_LAPACK_CONST char *jobu,
+                  __LILA_BLAS_LAPACK_CONST char *jobvt,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *s,
+                  blas_scomplex_t *U, __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                  blas_scomplex_t *VT,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                  blas_scomplex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_float_t *rwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cgesvd)
+  (jobu, jobvt, m, n, A, lda, s, U, ldu, VT, ldvt, work, lwork, rwork, info);
+}
+inline void gesvd(__LILA_BLAS_LAPACK_CONST char *jobu,
+                  __LILA_BLAS_LAPACK_CONST char *jobvt,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *s,
+                  blas_complex_t *U, __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                  blas_complex_t *VT,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                  blas_complex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_double_t *rwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zgesvd)
+  (jobu, jobvt, m, n, A, lda, s, U, ldu, VT, ldvt, work, lwork, rwork, info);
+}
+
+//////////////////////////
+// Least squares
+// Gels (QR or LQ, full rank)
+inline void gels(__LILA_BLAS_LAPACK_CONST char *trans,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs, blas_float_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb, blas_float_t *work,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                 blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(sgels)
+  (trans, m, n, nrhs, A, lda, B, ldb, work, lwork, info);
+}
+inline void gels(__LILA_BLAS_LAPACK_CONST char *trans,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs, blas_double_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb, blas_double_t *work,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                 blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dgels)
+  (trans, m, n, nrhs, A, lda, B, ldb, work, lwork, info);
+}
+inline void gels(__LILA_BLAS_LAPACK_CONST char *trans,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs, blas_scomplex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_scomplex_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                 blas_scomplex_t *work,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                 blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cgels)
+  (trans, m, n, nrhs, A, lda, B, ldb, work, lwork, info);
+}
+inline void gels(__LILA_BLAS_LAPACK_CONST char *trans,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs, blas_complex_t *A,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_complex_t *B,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                 blas_complex_t *work,
+                 __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                 blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zgels)
+  (trans, m, n, nrhs, A, lda, B, ldb, work, lwork, info);
+}
+
+// Gelsd (SVD, minimum norm)
+inline void gelsd(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs, blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *B,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldb, blas_float_t *s,
+                  __LILA_BLAS_LAPACK_CONST blas_float_t *rcond,
+                  blas_size_t *rank, blas_float_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *iwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(sgelsd)
+  (m, n, nrhs, A, lda, B, ldb, s, rcond, rank, work, lwork, iwork, info);
+}
+inline void gelsd(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs, blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *B,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldb, blas_double_t *s,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *rcond,
+                  blas_size_t *rank, blas_double_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *iwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dgelsd)
+  (m, n, nrhs, A, lda, B, ldb, s, rcond, rank, work, lwork, iwork, info);
+}
+inline void gelsd(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs,
+                  blas_scomplex_t *A, __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                  blas_scomplex_t *B, __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                  blas_float_t *s, __LILA_BLAS_LAPACK_CONST blas_float_t *rcond,
+                  blas_size_t *rank, blas_scomplex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_float_t *rwork, blas_size_t *iwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cgelsd)
+  (m, n, nrhs, A, lda, B, ldb, s, rcond, rank, work, lwork, rwork, iwork, info);
+}
+inline void gelsd(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs, blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_complex_t *B,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *ldb, blas_double_t *s,
+                  __LILA_BLAS_LAPACK_CONST blas_double_t *rcond,
+                  blas_size_t *rank, blas_complex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_double_t *rwork, blas_size_t *iwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zgelsd)
+  (m, n, nrhs, A, lda, B, ldb, s, rcond, rank, work, lwork, rwork, iwork, info);
+}
+
+// Geqp3 (QR with column pivoting)
+inline void geqp3(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_float_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_size_t *jpvt,
+                  blas_float_t *tau, blas_float_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(sgeqp3)
+  (m, n, A, lda, jpvt, tau, work, lwork, info);
+}
+inline void geqp3(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_double_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_size_t *jpvt,
+                  blas_double_t *tau, blas_double_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dgeqp3)
+  (m, n, A, lda, jpvt, tau, work, lwork, info);
+}
+inline void geqp3(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_scomplex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_size_t *jpvt,
+                  blas_scomplex_t *tau, blas_scomplex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_float_t *rwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cgeqp3)
+  (m, n, A, lda, jpvt, tau, work, lwork, rwork, info);
+}
+inline void geqp3(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_complex_t *A,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_size_t *jpvt,
+                  blas_complex_t *tau, blas_complex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_double_t *rwork, blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zgeqp3)
+  (m, n, A, lda, jpvt, tau, work, lwork, rwork, info);
+}
+
 //////////////////////////
 // Eigenvalues
 
@@ -649,6 +1644,63 @@ inline void syev(__LILA_BLAS_LAPACK_CONST char *jobz,
   heev(jobz, uplo, n, a, lda, w, work, lwork, rwork.data(), info);
 }
 
+// symmetric/hermitian, divide and conquer
+inline void syevd(__LILA_BLAS_LAPACK_CONST char *jobz,
+                  __LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_float_t *a,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *w,
+                  blas_float_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *iwork,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *liwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(ssyevd)
+  (jobz, uplo, n, a, lda, w, work, lwork, iwork, liwork, info);
+}
+
+inline void syevd(__LILA_BLAS_LAPACK_CONST char *jobz,
+                  __LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_double_t *a,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *w,
+                  blas_double_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_size_t *iwork,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *liwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(dsyevd)
+  (jobz, uplo, n, a, lda, w, work, lwork, iwork, liwork, info);
+}
+
+inline void heevd(__LILA_BLAS_LAPACK_CONST char *jobz,
+                  __LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_scomplex_t *a,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *w,
+                  blas_scomplex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_float_t *rwork,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lrwork,
+                  blas_size_t *iwork,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *liwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(cheevd)
+  (jobz, uplo, n, a, lda, w, work, lwork, rwork, lrwork, iwork, liwork, info);
+}
+
+inline void heevd(__LILA_BLAS_LAPACK_CONST char *jobz,
+                  __LILA_BLAS_LAPACK_CONST char *uplo,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_complex_t *a,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *w,
+                  blas_complex_t *work,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                  blas_double_t *rwork,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *lrwork,
+                  blas_size_t *iwork,
+                  __LILA_BLAS_LAPACK_CONST blas_size_t *liwork,
+                  blas_size_t *info) {
+  __LILA_BLAS_LAPACK_ROUTINE_NAME(zheevd)
+  (jobz, uplo, n, a, lda, w, work, lwork, rwork, lrwork, iwork, liwork, info);
+}
+
 // generic
 inline void geev(__LILA_BLAS_LAPACK_CONST char *jobvl,
                  __LILA_BLAS_LAPACK_CONST char *jobvr,
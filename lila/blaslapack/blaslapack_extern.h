@@ -202,6 +202,44 @@ extern "C" void zgemv_(__LILA_BLAS_LAPACK_CONST char *trans,
                        blas_complex_t *y,
                        __LILA_BLAS_LAPACK_CONST blas_size_t *incy);
 
+// Ger / Geru (unconjugated rank-1 update)
+extern "C" void sger_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                      __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                      __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                      __LILA_BLAS_LAPACK_CONST blas_float_t *x,
+                      __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                      __LILA_BLAS_LAPACK_CONST blas_float_t *y,
+                      __LILA_BLAS_LAPACK_CONST blas_size_t *incy,
+                      blas_float_t *A,
+                      __LILA_BLAS_LAPACK_CONST blas_size_t *lda);
+extern "C" void dger_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                      __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                      __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                      __LILA_BLAS_LAPACK_CONST blas_double_t *x,
+                      __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                      __LILA_BLAS_LAPACK_CONST blas_double_t *y,
+                      __LILA_BLAS_LAPACK_CONST blas_size_t *incy,
+                      blas_double_t *A,
+                      __LILA_BLAS_LAPACK_CONST blas_size_t *lda);
+extern "C" void cgeru_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *x,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *y,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incy,
+                       blas_scomplex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda);
+extern "C" void zgeru_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *x,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *y,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incy,
+                       blas_complex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda);
+
 // Gemm
 extern "C" void sgemm_(__LILA_BLAS_LAPACK_CONST char *transa,
                        __LILA_BLAS_LAPACK_CONST char *transb,
@@ -255,6 +293,256 @@ extern "C" void zgemm_(__LILA_BLAS_LAPACK_CONST char *transa,
                        __LILA_BLAS_LAPACK_CONST blas_complex_t *beta,
                        blas_complex_t *C,
                        __LILA_BLAS_LAPACK_CONST blas_size_t *dimc);
+
+// Syrk / Herk
+extern "C" void ssyrk_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *trans,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *beta,
+                       blas_float_t *C,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldc);
+extern "C" void dsyrk_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *trans,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *beta,
+                       blas_double_t *C,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldc);
+extern "C" void cherk_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *trans,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *beta,
+                       blas_scomplex_t *C,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldc);
+extern "C" void zherk_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *trans,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *beta,
+                       blas_complex_t *C,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldc);
+
+// Symm / Hemm
+extern "C" void ssymm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *beta,
+                       blas_float_t *C,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldc);
+extern "C" void dsymm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *beta,
+                       blas_double_t *C,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldc);
+extern "C" void csymm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *beta,
+                       blas_scomplex_t *C,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldc);
+extern "C" void zsymm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *beta,
+                       blas_complex_t *C,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldc);
+extern "C" void chemm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *beta,
+                       blas_scomplex_t *C,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldc);
+extern "C" void zhemm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *beta,
+                       blas_complex_t *C,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldc);
+
+// Trmm
+extern "C" void strmm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *transa,
+                       __LILA_BLAS_LAPACK_CONST char *diag,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       blas_float_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb);
+extern "C" void dtrmm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *transa,
+                       __LILA_BLAS_LAPACK_CONST char *diag,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       blas_double_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb);
+extern "C" void ctrmm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *transa,
+                       __LILA_BLAS_LAPACK_CONST char *diag,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       blas_scomplex_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb);
+extern "C" void ztrmm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *transa,
+                       __LILA_BLAS_LAPACK_CONST char *diag,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       blas_complex_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb);
+
+// Trsm
+extern "C" void strsm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *transa,
+                       __LILA_BLAS_LAPACK_CONST char *diag,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       blas_float_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb);
+extern "C" void dtrsm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *transa,
+                       __LILA_BLAS_LAPACK_CONST char *diag,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       blas_double_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb);
+extern "C" void ctrsm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *transa,
+                       __LILA_BLAS_LAPACK_CONST char *diag,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       blas_scomplex_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb);
+extern "C" void ztrsm_(__LILA_BLAS_LAPACK_CONST char *side,
+                       __LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST char *transa,
+                       __LILA_BLAS_LAPACK_CONST char *diag,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       blas_complex_t *B,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *ldb);
+
+// Symv / Hemv
+extern "C" void ssymv_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *x,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                       __LILA_BLAS_LAPACK_CONST blas_float_t *beta,
+                       blas_float_t *y,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incy);
+extern "C" void dsymv_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *x,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                       __LILA_BLAS_LAPACK_CONST blas_double_t *beta,
+                       blas_double_t *y,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incy);
+extern "C" void chemv_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *x,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                       __LILA_BLAS_LAPACK_CONST blas_scomplex_t *beta,
+                       blas_scomplex_t *y,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incy);
+extern "C" void zhemv_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *alpha,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *x,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incx,
+                       __LILA_BLAS_LAPACK_CONST blas_complex_t *beta,
+                       blas_complex_t *y,
+                       __LILA_BLAS_LAPACK_CONST blas_size_t *incy);
 #endif
 
 #ifdef LILA_USE_LAPACK
@@ -284,6 +572,31 @@ zgesv_(__LILA_BLAS_LAPACK_CONST blas_size_t *n,
        __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_size_t *ipiv,
        blas_complex_t *B, __LILA_BLAS_LAPACK_CONST blas_size_t *ldb, int *info);
 
+// Gesv with single precision factorization and iterative refinement
+extern "C" lapack_ret_t dsgesv_(__LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                                blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *ipiv,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_double_t *X,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldx,
+                                blas_double_t *work, blas_float_t *swork,
+                                blas_size_t *iter, blas_size_t *info);
+extern "C" lapack_ret_t zcgesv_(__LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                                blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *ipiv,
+                                __LILA_BLAS_LAPACK_CONST blas_complex_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_complex_t *X,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldx,
+                                blas_complex_t *work, blas_scomplex_t *swork,
+                                blas_double_t *rwork, blas_size_t *iter,
+                                blas_size_t *info);
+
 //////////////////////////
 // LU Decomposition
 // Getrf (performs LU Decomposition)
@@ -430,6 +743,60 @@ zungqr_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
         __LILA_BLAS_LAPACK_CONST blas_complex_t *tau, blas_complex_t *work,
         __LILA_BLAS_LAPACK_CONST blas_size_t *lwork, blas_size_t *info);
 
+// Ormqr / Unmqr (multiplies by the matrix Q of the QR Decomposition)
+extern "C" lapack_ret_t sormqr_(__LILA_BLAS_LAPACK_CONST char *side,
+                                __LILA_BLAS_LAPACK_CONST char *trans,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *tau,
+                                blas_float_t *C,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldc,
+                                blas_float_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t dormqr_(__LILA_BLAS_LAPACK_CONST char *side,
+                                __LILA_BLAS_LAPACK_CONST char *trans,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *tau,
+                                blas_double_t *C,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldc,
+                                blas_double_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t cunmqr_(__LILA_BLAS_LAPACK_CONST char *side,
+                                __LILA_BLAS_LAPACK_CONST char *trans,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                                __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_scomplex_t *tau,
+                                blas_scomplex_t *C,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldc,
+                                blas_scomplex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t zunmqr_(__LILA_BLAS_LAPACK_CONST char *side,
+                                __LILA_BLAS_LAPACK_CONST char *trans,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *k,
+                                __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_complex_t *tau,
+                                blas_complex_t *C,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldc,
+                                blas_complex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+
 //////////////////////////
 // Cholesky Decomposition
 extern "C" lapack_ret_t spotrf_(__LILA_BLAS_LAPACK_CONST char *uplo,
@@ -456,6 +823,496 @@ extern "C" lapack_ret_t zpotrf_(__LILA_BLAS_LAPACK_CONST char *uplo,
                                 __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
                                 blas_size_t *info);
 
+// Potrs (solves system of equations from Cholesky Decomposition)
+extern "C" lapack_ret_t spotrs_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_float_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_size_t *info);
+extern "C" lapack_ret_t dpotrs_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_double_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_size_t *info);
+extern "C" lapack_ret_t cpotrs_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                                __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_scomplex_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_size_t *info);
+extern "C" lapack_ret_t zpotrs_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                                __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_complex_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_size_t *info);
+
+// Potri (computes inverse from Cholesky Decomposition)
+extern "C" lapack_ret_t spotri_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *info);
+extern "C" lapack_ret_t dpotri_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *info);
+extern "C" lapack_ret_t cpotri_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *info);
+extern "C" lapack_ret_t zpotri_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *info);
+
+//////////////////////////
+// LDL^T Decomposition (Bunch-Kaufman)
+// Sytrf / Hetrf
+extern "C" lapack_ret_t ssytrf_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *ipiv, blas_float_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t dsytrf_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *ipiv, blas_double_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t chetrf_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *ipiv, blas_scomplex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t zhetrf_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *ipiv, blas_complex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+
+// Sytrs / Hetrs
+extern "C" lapack_ret_t ssytrs_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                blas_float_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_size_t *info);
+extern "C" lapack_ret_t dsytrs_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                blas_double_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_size_t *info);
+extern "C" lapack_ret_t chetrs_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                                __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                blas_scomplex_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_size_t *info);
+extern "C" lapack_ret_t zhetrs_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n_rhs,
+                                __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                blas_complex_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_size_t *info);
+
+// Sytri / Hetri
+extern "C" lapack_ret_t ssytri_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                blas_float_t *work, blas_size_t *info);
+extern "C" lapack_ret_t dsytri_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                blas_double_t *work, blas_size_t *info);
+extern "C" lapack_ret_t chetri_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                blas_scomplex_t *work, blas_size_t *info);
+extern "C" lapack_ret_t zhetri_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                blas_complex_t *work, blas_size_t *info);
+
+//////////////////////////
+// Condition number estimates
+// Gecon (from LU Decomposition)
+extern "C" lapack_ret_t sgecon_(__LILA_BLAS_LAPACK_CONST char *norm,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                                blas_float_t *rcond, blas_float_t *work,
+                                blas_size_t *iwork, blas_size_t *info);
+extern "C" lapack_ret_t dgecon_(__LILA_BLAS_LAPACK_CONST char *norm,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                                blas_double_t *rcond, blas_double_t *work,
+                                blas_size_t *iwork, blas_size_t *info);
+extern "C" lapack_ret_t cgecon_(__LILA_BLAS_LAPACK_CONST char *norm,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                                blas_float_t *rcond, blas_scomplex_t *work,
+                                blas_float_t *rwork, blas_size_t *info);
+extern "C" lapack_ret_t zgecon_(__LILA_BLAS_LAPACK_CONST char *norm,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                                blas_double_t *rcond, blas_complex_t *work,
+                                blas_double_t *rwork, blas_size_t *info);
+
+// Pocon (from Cholesky Decomposition)
+extern "C" lapack_ret_t spocon_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                                blas_float_t *rcond, blas_float_t *work,
+                                blas_size_t *iwork, blas_size_t *info);
+extern "C" lapack_ret_t dpocon_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                                blas_double_t *rcond, blas_double_t *work,
+                                blas_size_t *iwork, blas_size_t *info);
+extern "C" lapack_ret_t cpocon_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                                blas_float_t *rcond, blas_scomplex_t *work,
+                                blas_float_t *rwork, blas_size_t *info);
+extern "C" lapack_ret_t zpocon_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                                blas_double_t *rcond, blas_complex_t *work,
+                                blas_double_t *rwork, blas_size_t *info);
+
+// Sycon / Hecon (from LDL^T Decomposition)
+extern "C" lapack_ret_t ssycon_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                                blas_float_t *rcond, blas_float_t *work,
+                                blas_size_t *iwork, blas_size_t *info);
+extern "C" lapack_ret_t dsycon_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                                blas_double_t *rcond, blas_double_t *work,
+                                blas_size_t *iwork, blas_size_t *info);
+extern "C" lapack_ret_t checon_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *anorm,
+                                blas_float_t *rcond, blas_scomplex_t *work,
+                                blas_size_t *info);
+extern "C" lapack_ret_t zhecon_(__LILA_BLAS_LAPACK_CONST char *uplo,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ipiv,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *anorm,
+                                blas_double_t *rcond, blas_complex_t *work,
+                                blas_size_t *info);
+
+//////////////////////////
+// Singular value decomposition
+// Gesdd (divide and conquer)
+extern "C" lapack_ret_t sgesdd_(__LILA_BLAS_LAPACK_CONST char *jobz,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_float_t *s, blas_float_t *U,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                                blas_float_t *VT,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                                blas_float_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *iwork, blas_size_t *info);
+extern "C" lapack_ret_t dgesdd_(__LILA_BLAS_LAPACK_CONST char *jobz,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_double_t *s, blas_double_t *U,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                                blas_double_t *VT,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                                blas_double_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *iwork, blas_size_t *info);
+extern "C" lapack_ret_t cgesdd_(__LILA_BLAS_LAPACK_CONST char *jobz,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_float_t *s, blas_scomplex_t *U,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                                blas_scomplex_t *VT,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                                blas_scomplex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_float_t *rwork, blas_size_t *iwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t zgesdd_(__LILA_BLAS_LAPACK_CONST char *jobz,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_double_t *s, blas_complex_t *U,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                                blas_complex_t *VT,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                                blas_complex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_double_t *rwork, blas_size_t *iwork,
+                                blas_size_t *info);
+
+// Gesvd (QR iteration)
+extern "C" lapack_ret_t sgesvd_(__LILA_BLAS_LAPACK_CONST char *jobu,
+                                __LILA_BLAS_LAPACK_CONST char *jobvt,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_float_t *s, blas_float_t *U,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                                blas_float_t *VT,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                                blas_float_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t dgesvd_(__LILA_BLAS_LAPACK_CONST char *jobu,
+                                __LILA_BLAS_LAPACK_CONST char *jobvt,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_double_t *s, blas_double_t *U,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                                blas_double_t *VT,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                                blas_double_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t cgesvd_(__LILA_BLAS_LAPACK_CONST char *jobu,
+                                __LILA_BLAS_LAPACK_CONST char *jobvt,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_float_t *s, blas_scomplex_t *U,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                                blas_scomplex_t *VT,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                                blas_scomplex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_float_t *rwork, blas_size_t *info);
+extern "C" lapack_ret_t zgesvd_(__LILA_BLAS_LAPACK_CONST char *jobu,
+                                __LILA_BLAS_LAPACK_CONST char *jobvt,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_double_t *s, blas_complex_t *U,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldu,
+                                blas_complex_t *VT,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldvt,
+                                blas_complex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_double_t *rwork, blas_size_t *info);
+
+//////////////////////////
+// Least squares
+// Gels (QR or LQ, full rank)
+extern "C" lapack_ret_t sgels_(__LILA_BLAS_LAPACK_CONST char *trans,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs,
+                               blas_float_t *A,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                               blas_float_t *B,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                               blas_float_t *work,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                               blas_size_t *info);
+extern "C" lapack_ret_t dgels_(__LILA_BLAS_LAPACK_CONST char *trans,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs,
+                               blas_double_t *A,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                               blas_double_t *B,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                               blas_double_t *work,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                               blas_size_t *info);
+extern "C" lapack_ret_t cgels_(__LILA_BLAS_LAPACK_CONST char *trans,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs,
+                               blas_scomplex_t *A,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                               blas_scomplex_t *B,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                               blas_scomplex_t *work,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                               blas_size_t *info);
+extern "C" lapack_ret_t zgels_(__LILA_BLAS_LAPACK_CONST char *trans,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs,
+                               blas_complex_t *A,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                               blas_complex_t *B,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                               blas_complex_t *work,
+                               __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                               blas_size_t *info);
+
+// Gelsd (SVD, minimum norm)
+extern "C" lapack_ret_t sgelsd_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs,
+                                blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_float_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_float_t *s,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *rcond,
+                                blas_size_t *rank, blas_float_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *iwork, blas_size_t *info);
+extern "C" lapack_ret_t dgelsd_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs,
+                                blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_double_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_double_t *s,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *rcond,
+                                blas_size_t *rank, blas_double_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *iwork, blas_size_t *info);
+extern "C" lapack_ret_t cgelsd_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs,
+                                blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_scomplex_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_float_t *s,
+                                __LILA_BLAS_LAPACK_CONST blas_float_t *rcond,
+                                blas_size_t *rank, blas_scomplex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_float_t *rwork, blas_size_t *iwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t zgelsd_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *nrhs,
+                                blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_complex_t *B,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *ldb,
+                                blas_double_t *s,
+                                __LILA_BLAS_LAPACK_CONST blas_double_t *rcond,
+                                blas_size_t *rank, blas_complex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_double_t *rwork, blas_size_t *iwork,
+                                blas_size_t *info);
+
+// Geqp3 (QR with column pivoting)
+extern "C" lapack_ret_t sgeqp3_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_float_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *jpvt, blas_float_t *tau,
+                                blas_float_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t dgeqp3_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_double_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *jpvt, blas_double_t *tau,
+                                blas_double_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_size_t *info);
+extern "C" lapack_ret_t cgeqp3_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_scomplex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *jpvt, blas_scomplex_t *tau,
+                                blas_scomplex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_float_t *rwork, blas_size_t *info);
+extern "C" lapack_ret_t zgeqp3_(__LILA_BLAS_LAPACK_CONST blas_size_t *m,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *n,
+                                blas_complex_t *A,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lda,
+                                blas_size_t *jpvt, blas_complex_t *tau,
+                                blas_complex_t *work,
+                                __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+                                blas_double_t *rwork, blas_size_t *info);
+
 //////////////////////////
 // Eigenvalues
 
@@ -488,6 +1345,45 @@ zheev_(__LILA_BLAS_LAPACK_CONST char *jobz, __LILA_BLAS_LAPACK_CONST char *uplo,
        blas_complex_t *work, __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
        blas_double_t *rwork, blas_size_t *info);
 
+// symmetric/hermitian, divide and conquer
+extern "C" lapack_ret_t
+ssyevd_(__LILA_BLAS_LAPACK_CONST char *jobz,
+        __LILA_BLAS_LAPACK_CONST char *uplo,
+        __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_float_t *a,
+        __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *w,
+        blas_float_t *work, __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+        blas_size_t *iwork, __LILA_BLAS_LAPACK_CONST blas_size_t *liwork,
+        blas_size_t *info);
+
+extern "C" lapack_ret_t
+dsyevd_(__LILA_BLAS_LAPACK_CONST char *jobz,
+        __LILA_BLAS_LAPACK_CONST char *uplo,
+        __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_double_t *a,
+        __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *w,
+        blas_double_t *work, __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+        blas_size_t *iwork, __LILA_BLAS_LAPACK_CONST blas_size_t *liwork,
+        blas_size_t *info);
+
+extern "C" lapack_ret_t
+cheevd_(__LILA_BLAS_LAPACK_CONST char *jobz,
+        __LILA_BLAS_LAPACK_CONST char *uplo,
+        __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_scomplex_t *a,
+        __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_float_t *w,
+        blas_scomplex_t *work, __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+        blas_float_t *rwork, __LILA_BLAS_LAPACK_CONST blas_size_t *lrwork,
+        blas_size_t *iwork, __LILA_BLAS_LAPACK_CONST blas_size_t *liwork,
+        blas_size_t *info);
+
+extern "C" lapack_ret_t
+zheevd_(__LILA_BLAS_LAPACK_CONST char *jobz,
+        __LILA_BLAS_LAPACK_CONST char *uplo,
+        __LILA_BLAS_LAPACK_CONST blas_size_t *n, blas_complex_t *a,
+        __LILA_BLAS_LAPACK_CONST blas_size_t *lda, blas_double_t *w,
+        blas_complex_t *work, __LILA_BLAS_LAPACK_CONST blas_size_t *lwork,
+        blas_double_t *rwork, __LILA_BLAS_LAPACK_CONST blas_size_t *lrwork,
+        blas_size_t *iwork, __LILA_BLAS_LAPACK_CONST blas_size_t *liwork,
+        blas_size_t *info);
+
 // generic
 extern "C" lapack_ret_t
 sgeev_(__LILA_BLAS_LAPACK_CONST char *jobvl,
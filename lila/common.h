@@ -3,8 +3,19 @@
 #include <complex>
 #include <cstdint>
 
+// OpenMP directives, only active when compiling with -fopenmp
+#ifdef _OPENMP
+#define LILA_OMP(directive) _Pragma(#directive)
+#else
+#define LILA_OMP(directive)
+#endif
+
 namespace lila {
 using lila_size_t = int64_t;
+
+// Minimal number of elements for which element-wise kernels go parallel
+inline constexpr lila_size_t parallel_min_size = 1 << 15;
+
 using scomplex = std::complex<float>;
 using complex = std::complex<double>;
 
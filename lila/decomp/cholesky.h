@@ -1,7 +1,17 @@
 #pragma once
 
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <lila/algebra/mult.h>
 #include <lila/blaslapack/blaslapack.h>
+#include <lila/detail/factorization_detail.h>
 #include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/vector.h>
 
 namespace lila {
 
@@ -20,18 +30,308 @@ inline Matrix<coeff_t> Cholesky(const Matrix<coeff_t> &A, char uplo = 'U') {
   auto res = A;
   CholeskyInplace(res, uplo);
 
-  // Set lower triangular to zero
-  lila_size_t n = A.nrows();
-  if (uplo == 'U') {
-    for (lila_size_t j = 0; j < n; ++j)
-      for (lila_size_t i = j + 1; i < n; ++i)
-        res(i, j) = 0;
-  } else if (uplo == 'L') {
-    for (lila_size_t i = 0; i < n; ++i)
-      for (lila_size_t j = i + 1; j < n; ++j)
-        res(i, j) = 0;
-  }
+  // Set the other triangle to zero
+  detail::zero_triangle(res.data(), res.nrows(), res.nrows(),
+                        (uplo == 'U') ? 'L' : 'U');
   return res;
 }
 
+// Inverse of a Hermitian positive definite matrix by its Cholesky
+// decomposition (potrf + potri), half the flops of the LU based Invert
+template <class coeff_t>
+inline void InvertPositiveDefinite(Matrix<coeff_t> &A, char uplo = 'U') {
+  assert(A.nrows() == A.ncols());
+  blas_size_t n = A.nrows();
+  blas_size_t lda = std::max<blas_size_t>(n, 1);
+  blas_size_t info = 0;
+  blaslapack::potrf(&uplo, &n, LILA_BLAS_CAST(coeff_t, A.data()), &lda, &info);
+  assert(info == 0);
+  blaslapack::potri(&uplo, &n, LILA_BLAS_CAST(coeff_t, A.data()), &lda, &info);
+  assert(info == 0);
+  detail::fill_hermitian(A.data(), n, lda, uplo);
+}
+
+namespace detail {
+
+// Rank-1 update (sign 1) or downdate (sign -1) A' = A + sign x x^H of the
+// Cholesky factor in the uplo triangle of a, with x overwritten. Returns 0,
+// or k + 1 if A' is not positive definite because of its leading minor of
+// order k + 1, in which case a is only partially updated.
+//
+// Written for L = R^H, column k of L and x transform as
+//   L'(j, k) = (L(k, k) L(j, k) + sign conj(x_k) x_j) / r
+//   x'_j = (L(k, k) x_j - x_k L(j, k)) / r
+// with r^2 = L(k, k)^2 + sign |x_k|^2, a Givens rotation for the update and a
+// hyperbolic one for the downdate.
+template <class coeff_t>
+inline blas_size_t cholesky_rank1(coeff_t *a, lila_size_t n, lila_size_t lda,
+                                  char uplo, coeff_t *x,
+                                  real_t<coeff_t> sign) {
+  using real_type = real_t<coeff_t>;
+  assert((uplo == 'U') || (uplo == 'L'));
+  bool upper = (uplo == 'U');
+  for (lila_size_t k = 0; k < n; ++k) {
+    real_type lkk = real(a[k + k * lda]);
+    real_type r2 = lkk * lkk + sign * std::norm(x[k]);
+    if (!(r2 > 0.))
+      return k + 1;
+    real_type r = std::sqrt(r2);
+    coeff_t xk = x[k];
+    a[k + k * lda] = r;
+    for (lila_size_t j = k + 1; j < n; ++j) {
+      coeff_t &ajk = upper ? a[k + j * lda] : a[j + k * lda];
+      coeff_t ljk = upper ? lila::conj(ajk) : ajk;
+      coeff_t lnew = (lkk * ljk + sign * lila::conj(xk) * x[j]) / r;
+      x[j] = (lkk * x[j] - xk * ljk) / r;
+      ajk = upper ? lila::conj(lnew) : lnew;
+    }
+  }
+  return 0;
+}
+
+// Rank-k version for A' = A + sign X X^H, one column of X at a time
+template <class coeff_t>
+inline blas_size_t cholesky_rank_k(Matrix<coeff_t> &R, Matrix<coeff_t> const &X,
+                                   char uplo, real_t<coeff_t> sign) {
+  assert(R.nrows() == R.ncols());
+  assert(X.nrows() == R.nrows());
+  lila_size_t n = R.nrows();
+  std::vector<coeff_t> x(n);
+  for (lila_size_t j = 0; j < X.ncols(); ++j) {
+    std::copy(X.data() + j * n, X.data() + (j + 1) * n, x.data());
+    blas_size_t info =
+        cholesky_rank1(R.data(), n, blas_ld(R), uplo, x.data(), sign);
+    if (info != 0)
+      return info;
+  }
+  return 0;
+}
+
+} // namespace detail
+
+// Updates a Cholesky factor, A = R^H R (uplo 'U') or A = L L^H (uplo 'L') in
+// the uplo triangle of R as computed by CholeskyInplace, to the factor of
+// A + X X^H in O(n^2 k) for n x k X, instead of O(n^3) for a new
+// decomposition. The other triangle of R is not referenced.
+template <class coeff_t>
+inline void CholeskyUpdate(Matrix<coeff_t> &R, Matrix<coeff_t> const &X,
+                           char uplo = 'U') {
+  blas_size_t info = detail::cholesky_rank_k(R, X, uplo, real_t<coeff_t>(1.));
+  assert(info == 0);
+  (void)info;
+}
+
+template <class coeff_t>
+inline void CholeskyUpdate(Matrix<coeff_t> &R, Vector<coeff_t> x,
+                           char uplo = 'U') {
+  assert(x.size() == R.nrows());
+  blas_size_t info = detail::cholesky_rank1(
+      R.data(), R.nrows(), detail::blas_ld(R), uplo, x.data(), 1.);
+  assert(info == 0);
+  (void)info;
+}
+
+// Downdates a Cholesky factor to the one of A - X X^H. Returns false if that
+// is not positive definite, R is then no longer a valid factor.
+template <class coeff_t>
+inline bool CholeskyDowndate(Matrix<coeff_t> &R, Matrix<coeff_t> const &X,
+                             char uplo = 'U') {
+  return detail::cholesky_rank_k(R, X, uplo, real_t<coeff_t>(-1.)) == 0;
+}
+
+template <class coeff_t>
+inline bool CholeskyDowndate(Matrix<coeff_t> &R, Vector<coeff_t> x,
+                             char uplo = 'U') {
+  assert(x.size() == R.nrows());
+  return detail::cholesky_rank1(R.data(), R.nrows(), detail::blas_ld(R), uplo,
+                                x.data(), -1.) == 0;
+}
+
+// Cholesky decomposition A = U^H U (uplo 'U') or A = L L^H (uplo 'L') of a
+// Hermitian positive definite matrix (potrf), computed once and reused for
+// any number of solves. Only the uplo triangle of A is referenced.
+// Constructing from an rvalue factors the matrix in its own storage without
+// a copy.
+template <class coeff_t> class CholeskyFactor {
+public:
+  using real_type = real_t<coeff_t>;
+
+  CholeskyFactor() = default;
+  explicit CholeskyFactor(Matrix<coeff_t> const &A, char uplo = 'U')
+      : fac_(A), uplo_(uplo) {
+    factor();
+  }
+  explicit CholeskyFactor(Matrix<coeff_t> &&A, char uplo = 'U')
+      : fac_(std::move(A)), uplo_(uplo) {
+    factor();
+  }
+
+  lila_size_t n() const { return fac_.nrows(); }
+  char uplo() const { return uplo_; }
+  blas_size_t info() const { return info_; }
+  bool positive_definite() const { return info_ == 0; }
+
+  Matrix<coeff_t> const &factors() const { return fac_; }
+
+  // The triangular factor U or L, the other triangle set to zero
+  Matrix<coeff_t> triangular_factor() const {
+    auto res = fac_;
+    detail::zero_triangle(res.data(), n(), detail::blas_ld(res),
+                          (uplo_ == 'U') ? 'L' : 'U');
+    return res;
+  }
+
+  // Refactors to A + X X^H or A - X X^H for an n x k matrix or vector X in
+  // O(n^2 k). A failed downdate leaves an indefinite factor. After updates
+  // rcond() uses the bound ||A||_1 + ||X X^H||_1 for the norm of A.
+  template <class vec_t> void update(vec_t const &X) {
+    assert(positive_definite());
+    CholeskyUpdate(fac_, X, uplo_);
+    anorm_ += outer_norm1(X);
+  }
+
+  template <class vec_t> bool downdate(vec_t const &X) {
+    assert(positive_definite());
+    info_ = detail::cholesky_rank_k(fac_, Matrix<coeff_t>(X), uplo_,
+                                    real_type(-1.));
+    anorm_ += outer_norm1(X);
+    return positive_definite();
+  }
+
+  // A X = B, B is overwritten by X
+  void solve_inplace(MatrixView<coeff_t> B) const {
+    assert(positive_definite());
+    assert(B.m() == n());
+    char uplo = uplo_;
+    blas_size_t bn = n();
+    blas_size_t n_rhs = B.n();
+    blas_size_t lda = detail::blas_ld(fac_);
+    blas_size_t ldb = detail::blas_ld(B);
+    blas_size_t info = 0;
+    blaslapack::potrs(&uplo, &bn, &n_rhs,
+                      LILA_BLAS_CONST_CAST(coeff_t, fac_.data()), &lda,
+                      LILA_BLAS_CAST(coeff_t, B.data()), &ldb, &info);
+    assert(info == 0);
+  }
+
+  void solve_inplace(Matrix<coeff_t> &B) const {
+    solve_inplace(MatrixView<coeff_t>(B));
+  }
+
+  void solve_inplace(Vector<coeff_t> &b) const {
+    solve_inplace(detail::column_view(b));
+  }
+
+  // b must be contiguous
+  void solve_inplace(VectorView<coeff_t> b) const {
+    solve_inplace(detail::column_view(b));
+  }
+
+  // A^-1 B and A^-T B = conj(A^-1 conj(B)) as a new Matrix or Vector, also
+  // for a view B, which is left unchanged
+  template <class vec_t> auto solve(vec_t const &B) const {
+    auto X = detail::owning_copy(B);
+    solve_inplace(X);
+    return X;
+  }
+
+  template <class vec_t> auto solve_transposed(vec_t const &B) const {
+    auto X = detail::owning_copy(B);
+    auto XV = view(X);
+    detail::conj_inplace(XV);
+    solve_inplace(XV);
+    detail::conj_inplace(XV);
+    return X;
+  }
+
+  // log det A = 2 sum_i log R_ii
+  real_type log_det() const { return detail::cholesky_log_det(fac_); }
+
+  real_type det() const { return std::exp(log_det()); }
+
+  Matrix<coeff_t> inverse() const {
+    assert(positive_definite());
+    Matrix<coeff_t> inv = fac_;
+    char uplo = uplo_;
+    blas_size_t bn = n();
+    blas_size_t lda = detail::blas_ld(inv);
+    blas_size_t info = 0;
+    blaslapack::potri(&uplo, &bn, LILA_BLAS_CAST(coeff_t, inv.data()), &lda,
+                      &info);
+    assert(info == 0);
+    detail::fill_hermitian(inv.data(), n(), n(), uplo_);
+    return inv;
+  }
+
+  // Estimate of the reciprocal condition number in the 1-norm (pocon)
+  real_type rcond() const {
+    if (!positive_definite())
+      return 0.;
+    char uplo = uplo_;
+    blas_size_t bn = n();
+    blas_size_t lda = detail::blas_ld(fac_);
+    blas_size_t info = 0;
+    real_type anorm = anorm_;
+    real_type rc = 0.;
+    if constexpr (is_complex<coeff_t>()) {
+      std::vector<coeff_t> work(2 * n());
+      std::vector<real_type> rwork(n());
+      blaslapack::pocon(&uplo, &bn, LILA_BLAS_CONST_CAST(coeff_t, fac_.data()),
+                        &lda, &anorm, &rc,
+                        LILA_BLAS_CAST(coeff_t, work.data()), rwork.data(),
+                        &info);
+    } else {
+      std::vector<coeff_t> work(3 * n());
+      std::vector<blas_size_t> iwork(n());
+      blaslapack::pocon(&uplo, &bn, LILA_BLAS_CONST_CAST(coeff_t, fac_.data()),
+                        &lda, &anorm, &rc,
+                        LILA_BLAS_CAST(coeff_t, work.data()), iwork.data(),
+                        &info);
+    }
+    assert(info == 0);
+    return rc;
+  }
+
+private:
+  Matrix<coeff_t> fac_;
+  char uplo_ = 'U';
+  blas_size_t info_ = 0;
+  real_type anorm_ = 0.;
+
+  static MatrixView<coeff_t> view(Matrix<coeff_t> &X) {
+    return MatrixView<coeff_t>(X);
+  }
+  static MatrixView<coeff_t> view(Vector<coeff_t> &x) {
+    return detail::column_view(x);
+  }
+  static MatrixView<coeff_t> view(MatrixView<coeff_t> X) { return X; }
+
+  // ||X X^H||_1 <= sum_j ||x_j||_1 ||x_j||_inf over the columns x_j of X
+  template <class vec_t> real_type outer_norm1(vec_t const &X) const {
+    Matrix<coeff_t> Xm(X);
+    real_type res = 0.;
+    for (lila_size_t j = 0; j < Xm.ncols(); ++j) {
+      real_type n1 = 0.;
+      real_type ninf = 0.;
+      for (lila_size_t i = 0; i < Xm.nrows(); ++i) {
+        n1 += std::abs(Xm(i, j));
+        ninf = std::max(ninf, (real_type)std::abs(Xm(i, j)));
+      }
+      res += n1 * ninf;
+    }
+    return res;
+  }
+
+  void factor() {
+    assert(fac_.nrows() == fac_.ncols());
+    assert((uplo_ == 'U') || (uplo_ == 'L'));
+    anorm_ = detail::norm1_hermitian(fac_, uplo_);
+    blas_size_t bn = n();
+    blas_size_t lda = detail::blas_ld(fac_);
+    blaslapack::potrf(&uplo_, &bn, LILA_BLAS_CAST(coeff_t, fac_.data()), &lda,
+                      &info_);
+    assert(info_ >= 0);
+  }
+};
+
 } // namespace lila
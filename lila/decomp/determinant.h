@@ -1,6 +1,14 @@
 #pragma once
 
+#include <utility>
+#include <vector>
+
+#include <lila/algebra/mult.h>
+#include <lila/decomp/cholesky.h>
+#include <lila/decomp/ldlt.h>
+#include <lila/decomp/lu.h>
 #include <lila/decomp/solve.h>
+#include <lila/detail/factorization_detail.h>
 #include <lila/matrix.h>
 
 #include <lila/utils/print.h>
@@ -11,23 +19,68 @@ template <class coeff_t> coeff_t DeterminantInplace(Matrix<coeff_t> &A) {
   auto ipiv = LUDecompose(A);
 
   coeff_t det = 1.0;
-  int sign = 0;
-  for (lila_size_t i = 0; i < A.m(); ++i) {
-
-    if (ipiv[i] != i + 1) {
-      sign ^= 1;
-    }
-
+  for (lila_size_t i = 0; i < A.m(); ++i)
     det *= A(i, i);
-  }
-  if (sign & 1)
-    return -det;
-  else
-    return det;
+  return (detail::pivot_swaps(ipiv) & 1) ? -det : det;
 }
 
 template <class coeff_t> coeff_t Determinant(Matrix<coeff_t> A) {
   return DeterminantInplace(A);
 }
 
+// (log|det A|, det A / |det A|), which does not overflow or underflow for
+// large matrices. Hermitian matrices are first tried with a Cholesky
+// decomposition and only fall back to LU if they are not positive definite.
+template <class coeff_t>
+inline std::pair<real_t<coeff_t>, coeff_t> LogDetInplace(Matrix<coeff_t> &A) {
+  assert(A.nrows() == A.ncols());
+  blas_size_t n = A.nrows();
+  blas_size_t lda = detail::blas_ld(A);
+  blas_size_t info = 0;
+
+  if (detail::is_hermitian(A)) {
+    std::vector<coeff_t> diag(n);
+    for (blas_size_t i = 0; i < n; ++i)
+      diag[i] = A(i, i);
+    char uplo = 'L';
+    blaslapack::potrf(&uplo, &n, LILA_BLAS_CAST(coeff_t, A.data()), &lda,
+                      &info);
+    if (info == 0)
+      return {detail::cholesky_log_det(A), coeff_t(1.)};
+
+    // not positive definite, restore A from its upper triangle
+    for (blas_size_t i = 0; i < n; ++i)
+      A(i, i) = diag[i];
+    detail::fill_hermitian(A.data(), n, lda, 'U');
+  }
+
+  std::vector<blas_size_t> ipiv(n);
+  blaslapack::getrf(&n, &n, LILA_BLAS_CAST(coeff_t, A.data()), &lda,
+                    ipiv.data(), &info);
+  assert(info >= 0);
+  return detail::lu_log_det(A, ipiv);
+}
+
+template <class coeff_t>
+inline std::pair<real_t<coeff_t>, coeff_t> LogDet(Matrix<coeff_t> A) {
+  return LogDetInplace(A);
+}
+
+// Log-determinants of cached factorizations
+template <class coeff_t>
+inline std::pair<real_t<coeff_t>, coeff_t> LogDet(LU<coeff_t> const &lu) {
+  return detail::lu_log_det(lu.factors(), lu.pivots());
+}
+
+template <class coeff_t>
+inline std::pair<real_t<coeff_t>, coeff_t>
+LogDet(CholeskyFactor<coeff_t> const &chol) {
+  return {chol.log_det(), coeff_t(1.)};
+}
+
+template <class coeff_t>
+inline std::pair<real_t<coeff_t>, coeff_t> LogDet(LDLT<coeff_t> const &ldlt) {
+  return {ldlt.log_det(), coeff_t(ldlt.det_sign())};
+}
+
 } // namespace lila
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <lila/algebra/mult.h>
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+namespace detail {
+
+// Givens rotation G = [c s; -conj(s) c] with real c and G [f; g] = [r; 0]
+template <class coeff_t>
+inline void givens(coeff_t f, coeff_t g, real_t<coeff_t> &c, coeff_t &s,
+                   coeff_t &r) {
+  using real_type = real_t<coeff_t>;
+  if (g == coeff_t(0.)) {
+    c = 1.;
+    s = 0.;
+    r = f;
+  } else if (f == coeff_t(0.)) {
+    c = 0.;
+    s = lila::conj(g) / std::abs(g);
+    r = std::abs(g);
+  } else {
+    real_type af = std::abs(f);
+    real_type norm = std::hypot(af, std::abs(g));
+    coeff_t phase = f / af;
+    c = af / norm;
+    s = phase * lila::conj(g) / norm;
+    r = phase * norm;
+  }
+}
+
+} // namespace detail
+
+// Thin QR decomposition A = Q R of an m x k matrix that is built up one
+// column at a time, e.g. a growing Krylov basis. Appending a column costs
+// O(m k) by classical Gram-Schmidt with reorthogonalization (CGS2),
+// deleting one costs O((m + k) k) by a sweep of Givens rotations, instead of
+// O(m k^2) for a new QRDecompose. Q is stored explicitly, and Q and R are
+// allocated for max_cols columns up front.
+template <class coeff_t> class IncrementalQR {
+public:
+  using real_type = real_t<coeff_t>;
+
+  IncrementalQR() = default;
+  IncrementalQR(lila_size_t m, lila_size_t max_cols)
+      : Q_(m, max_cols), R_(max_cols, max_cols), work_(max_cols) {
+    assert(max_cols <= m);
+  }
+
+  lila_size_t nrows() const { return Q_.nrows(); }
+  lila_size_t ncols() const { return k_; }
+  lila_size_t max_cols() const { return Q_.ncols(); }
+
+  // Appends the column a and returns the new diagonal entry R(k, k) > 0. If
+  // the part of a orthogonal to the current columns is at rounding level,
+  // |a - Q Q^H a| <= m eps |a|, a lies numerically in their span (e.g. a
+  // GMRES breakdown). It is then not appended and 0 is returned.
+  real_type append_column(Vector<coeff_t> const &a) {
+    assert(a.size() == nrows());
+    assert(k_ < max_cols());
+    lila_size_t m = nrows();
+    lila_size_t ld = max_cols();
+    coeff_t *q = Q_.data() + k_ * m;
+    coeff_t *r = R_.data() + k_ * ld;
+    std::copy(a.begin(), a.end(), q);
+    std::fill(r, r + ld, coeff_t(0.));
+    real_type anorm = 0.;
+    for (lila_size_t i = 0; i < m; ++i)
+      anorm += std::norm(q[i]);
+    anorm = std::sqrt(anorm);
+
+    // q -= Q (Q^H q), twice to keep Q orthonormal to working precision
+    if (k_ > 0)
+      for (int pass = 0; pass < 2; ++pass) {
+        detail::gemv('C', m, k_, coeff_t(1.), Q_.data(), m, q, 1, coeff_t(0.),
+                     work_.data(), 1);
+        detail::gemv('N', m, k_, coeff_t(-1.), Q_.data(), m, work_.data(), 1,
+                     coeff_t(1.), q, 1);
+        for (lila_size_t i = 0; i < k_; ++i)
+          r[i] += work_[i];
+      }
+
+    real_type rho = 0.;
+    for (lila_size_t i = 0; i < m; ++i)
+      rho += std::norm(q[i]);
+    rho = std::sqrt(rho);
+    if (rho <= m * std::numeric_limits<real_type>::epsilon() * anorm) {
+      std::fill(r, r + ld, coeff_t(0.));
+      return 0.;
+    }
+    for (lila_size_t i = 0; i < m; ++i)
+      q[i] /= rho;
+    r[k_] = rho;
+    ++k_;
+    return rho;
+  }
+
+  // Removes column j. The remaining columns of R form an upper Hessenberg
+  // block from column j on, which is restored to triangular form by Givens
+  // rotations of neighbouring rows, applied to the columns of Q as well. The
+  // diagonal of R stays real and positive.
+  void delete_column(lila_size_t j) {
+    assert(j < k_);
+    lila_size_t m = nrows();
+    lila_size_t ld = max_cols();
+    coeff_t *q = Q_.data();
+    coeff_t *r = R_.data();
+    std::copy(r + (j + 1) * ld, r + k_ * ld, r + j * ld);
+
+    for (lila_size_t i = j; i + 1 < k_; ++i) {
+      real_type c;
+      coeff_t s;
+      coeff_t rii;
+      detail::givens(r[i + i * ld], r[i + 1 + i * ld], c, s, rii);
+      r[i + i * ld] = rii;
+      r[i + 1 + i * ld] = 0.;
+      for (lila_size_t l = i + 1; l + 1 < k_; ++l) {
+        coeff_t x = r[i + l * ld];
+        coeff_t y = r[i + 1 + l * ld];
+        r[i + l * ld] = c * x + s * y;
+        r[i + 1 + l * ld] = -lila::conj(s) * x + c * y;
+      }
+
+      // Q G^H
+      coeff_t *qi = q + i * m;
+      coeff_t *qn = q + (i + 1) * m;
+      for (lila_size_t l = 0; l < m; ++l) {
+        coeff_t x = qi[l];
+        coeff_t y = qn[l];
+        qi[l] = c * x + lila::conj(s) * y;
+        qn[l] = -s * x + c * y;
+      }
+
+      // keep R(i, i) real and positive
+      real_type arii = std::abs(rii);
+      if ((arii > 0.) && (rii != coeff_t(arii))) {
+        coeff_t phase = rii / arii;
+        r[i + i * ld] = arii;
+        for (lila_size_t l = i + 1; l + 1 < k_; ++l)
+          r[i + l * ld] *= lila::conj(phase);
+        for (lila_size_t l = 0; l < m; ++l)
+          qi[l] *= phase;
+      }
+    }
+    --k_;
+    std::fill(r + k_ * ld, r + (k_ + 1) * ld, coeff_t(0.));
+    for (lila_size_t l = 0; l < k_; ++l)
+      r[k_ + l * ld] = 0.;
+  }
+
+  // Solves R x = y for the current k x k upper triangular R
+  Vector<coeff_t> solve_upper(Vector<coeff_t> const &y) const {
+    assert(y.size() == k_);
+    Vector<coeff_t> x = y;
+    if (k_ == 0)
+      return x;
+    char side = 'L';
+    char uplo = 'U';
+    char trans = 'N';
+    char diag = 'N';
+    blas_size_t k = k_;
+    blas_size_t nrhs = 1;
+    blas_size_t lda = max_cols();
+    coeff_t alpha = 1.;
+    blaslapack::trsm(&side, &uplo, &trans, &diag, &k, &nrhs,
+                     LILA_BLAS_CAST(coeff_t, &alpha),
+                     LILA_BLAS_CONST_CAST(coeff_t, R_.data()), &lda,
+                     LILA_BLAS_CAST(coeff_t, x.data()), &k);
+    return x;
+  }
+
+  // Q^H b, with k entries
+  Vector<coeff_t> apply_qh(Vector<coeff_t> const &b) const {
+    assert(b.size() == nrows());
+    Vector<coeff_t> res(k_);
+    if (k_ > 0)
+      detail::gemv('C', nrows(), k_, coeff_t(1.), Q_.data(), nrows(),
+                   b.data(), 1, coeff_t(0.), res.data(), 1);
+    return res;
+  }
+
+  // The least-squares solution of min ||A x - b|| = R^-1 Q^H b
+  Vector<coeff_t> solve(Vector<coeff_t> const &b) const {
+    return solve_upper(apply_qh(b));
+  }
+
+  // The current m x k factor Q and k x k factor R
+  Matrix<coeff_t> Q() const {
+    Matrix<coeff_t> res(nrows(), k_);
+    std::copy(Q_.data(), Q_.data() + nrows() * k_, res.data());
+    return res;
+  }
+  Matrix<coeff_t> R() const {
+    Matrix<coeff_t> res(k_, k_);
+    for (lila_size_t j = 0; j < k_; ++j)
+      for (lila_size_t i = 0; i <= j; ++i)
+        res(i, j) = R_(i, j);
+    return res;
+  }
+
+private:
+  Matrix<coeff_t> Q_;
+  Matrix<coeff_t> R_;
+  lila_size_t k_ = 0;
+  std::vector<coeff_t> work_;
+};
+
+} // namespace lila
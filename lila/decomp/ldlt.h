@@ -0,0 +1,228 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <lila/algebra/mult.h>
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/detail/factorization_detail.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+// Decomposition A = U D U^H (uplo 'U') or A = L D L^H (uplo 'L') of a
+// Hermitian (symmetric if real) indefinite matrix with Bunch-Kaufman
+// pivoting (sytrf / hetrf), where D is block diagonal with 1 x 1 and 2 x 2
+// blocks. Only the uplo triangle of A is referenced. Constructing from an
+// rvalue factors the matrix in its own storage without a copy.
+template <class coeff_t> class LDLT {
+public:
+  using real_type = real_t<coeff_t>;
+
+  LDLT() = default;
+  explicit LDLT(Matrix<coeff_t> const &A, char uplo = 'U')
+      : fac_(A), uplo_(uplo) {
+    factor();
+  }
+  explicit LDLT(Matrix<coeff_t> &&A, char uplo = 'U')
+      : fac_(std::move(A)), uplo_(uplo) {
+    factor();
+  }
+
+  lila_size_t n() const { return fac_.nrows(); }
+  char uplo() const { return uplo_; }
+  blas_size_t info() const { return info_; }
+  bool singular() const { return info_ > 0; }
+  Matrix<coeff_t> const &factors() const { return fac_; }
+  std::vector<blas_size_t> const &pivots() const { return ipiv_; }
+
+  // A X = B, B is overwritten by X
+  void solve_inplace(MatrixView<coeff_t> B) const {
+    assert(!singular());
+    assert(B.m() == n());
+    char uplo = uplo_;
+    blas_size_t bn = n();
+    blas_size_t n_rhs = B.n();
+    blas_size_t lda = detail::blas_ld(fac_);
+    blas_size_t ldb = detail::blas_ld(B);
+    blas_size_t info = 0;
+    if constexpr (is_complex<coeff_t>()) {
+      blaslapack::hetrs(&uplo, &bn, &n_rhs,
+                        LILA_BLAS_CONST_CAST(coeff_t, fac_.data()), &lda,
+                        LILA_BLAS_CONST_CAST(blas_size_t, ipiv_.data()),
+                        LILA_BLAS_CAST(coeff_t, B.data()), &ldb, &info);
+    } else {
+      blaslapack::sytrs(&uplo, &bn, &n_rhs,
+                        LILA_BLAS_CONST_CAST(coeff_t, fac_.data()), &lda,
+                        LILA_BLAS_CONST_CAST(blas_size_t, ipiv_.data()),
+                        LILA_BLAS_CAST(coeff_t, B.data()), &ldb, &info);
+    }
+    assert(info == 0);
+  }
+
+  void solve_inplace(Matrix<coeff_t> &B) const {
+    solve_inplace(MatrixView<coeff_t>(B));
+  }
+
+  void solve_inplace(Vector<coeff_t> &b) const {
+    solve_inplace(detail::column_view(b));
+  }
+
+  // b must be contiguous
+  void solve_inplace(VectorView<coeff_t> b) const {
+    solve_inplace(detail::column_view(b));
+  }
+
+  // A^-1 B and A^-T B = conj(A^-1 conj(B)) as a new Matrix or Vector, also
+  // for a view B, which is left unchanged
+  template <class vec_t> auto solve(vec_t const &B) const {
+    auto X = detail::owning_copy(B);
+    solve_inplace(X);
+    return X;
+  }
+
+  template <class vec_t> auto solve_transposed(vec_t const &B) const {
+    auto X = detail::owning_copy(B);
+    auto XV = view(X);
+    detail::conj_inplace(XV);
+    solve_inplace(XV);
+    detail::conj_inplace(XV);
+    return X;
+  }
+
+  // det A = det_sign() * exp(log_det()) = det D, which is real
+  real_type log_det() const {
+    real_type res = 0.;
+    for_each_block([&res](real_type d) { res += std::log(std::abs(d)); });
+    return res;
+  }
+
+  real_type det_sign() const {
+    real_type sign = 1.;
+    for_each_block([&sign](real_type d) {
+      sign *= (d > 0.) ? 1. : ((d < 0.) ? -1. : 0.);
+    });
+    return sign;
+  }
+
+  real_type det() const { return det_sign() * std::exp(log_det()); }
+
+  Matrix<coeff_t> inverse() const {
+    assert(!singular());
+    Matrix<coeff_t> inv = fac_;
+    char uplo = uplo_;
+    blas_size_t bn = n();
+    blas_size_t lda = detail::blas_ld(inv);
+    blas_size_t info = 0;
+    std::vector<coeff_t> work(std::max(n(), (lila_size_t)1));
+    if constexpr (is_complex<coeff_t>()) {
+      blaslapack::hetri(&uplo, &bn, LILA_BLAS_CAST(coeff_t, inv.data()), &lda,
+                        LILA_BLAS_CONST_CAST(blas_size_t, ipiv_.data()),
+                        LILA_BLAS_CAST(coeff_t, work.data()), &info);
+    } else {
+      blaslapack::sytri(&uplo, &bn, LILA_BLAS_CAST(coeff_t, inv.data()), &lda,
+                        LILA_BLAS_CONST_CAST(blas_size_t, ipiv_.data()),
+                        LILA_BLAS_CAST(coeff_t, work.data()), &info);
+    }
+    assert(info == 0);
+    detail::fill_hermitian(inv.data(), n(), n(), uplo_);
+    return inv;
+  }
+
+  // Estimate of the reciprocal condition number in the 1-norm (sycon /
+  // hecon)
+  real_type rcond() const {
+    if (singular())
+      return 0.;
+    char uplo = uplo_;
+    blas_size_t bn = n();
+    blas_size_t lda = detail::blas_ld(fac_);
+    blas_size_t info = 0;
+    real_type anorm = anorm_;
+    real_type rc = 0.;
+    std::vector<coeff_t> work(2 * n());
+    if constexpr (is_complex<coeff_t>()) {
+      blaslapack::hecon(&uplo, &bn, LILA_BLAS_CONST_CAST(coeff_t, fac_.data()),
+                        &lda, LILA_BLAS_CONST_CAST(blas_size_t, ipiv_.data()),
+                        &anorm, &rc, LILA_BLAS_CAST(coeff_t, work.data()),
+                        &info);
+    } else {
+      std::vector<blas_size_t> iwork(n());
+      blaslapack::sycon(&uplo, &bn, LILA_BLAS_CONST_CAST(coeff_t, fac_.data()),
+                        &lda, LILA_BLAS_CONST_CAST(blas_size_t, ipiv_.data()),
+                        &anorm, &rc, LILA_BLAS_CAST(coeff_t, work.data()),
+                        iwork.data(), &info);
+    }
+    assert(info == 0);
+    return rc;
+  }
+
+private:
+  Matrix<coeff_t> fac_;
+  char uplo_ = 'U';
+  std::vector<blas_size_t> ipiv_;
+  blas_size_t info_ = 0;
+  real_type anorm_ = 0.;
+
+  static MatrixView<coeff_t> view(Matrix<coeff_t> &X) {
+    return MatrixView<coeff_t>(X);
+  }
+  static MatrixView<coeff_t> view(Vector<coeff_t> &x) {
+    return detail::column_view(x);
+  }
+  static MatrixView<coeff_t> view(MatrixView<coeff_t> X) { return X; }
+
+  // Calls f(d) with the determinant d of every diagonal block of D. A 2 x 2
+  // block at rows k, k + 1 is marked by ipiv[k] = ipiv[k + 1] < 0.
+  template <class function_t> void for_each_block(function_t f) const {
+    for (lila_size_t k = 0; k < n(); ++k) {
+      if (ipiv_[k] > 0)
+        f(real(fac_(k, k)));
+      else {
+        coeff_t b = (uplo_ == 'U') ? fac_(k, k + 1) : fac_(k + 1, k);
+        f(real(fac_(k, k)) * real(fac_(k + 1, k + 1)) -
+          std::abs(b) * std::abs(b));
+        ++k;
+      }
+    }
+  }
+
+  void factor() {
+    assert(fac_.nrows() == fac_.ncols());
+    assert((uplo_ == 'U') || (uplo_ == 'L'));
+    anorm_ = detail::norm1_hermitian(fac_, uplo_);
+    blas_size_t bn = n();
+    blas_size_t lda = detail::blas_ld(fac_);
+    ipiv_.resize(n());
+
+    // get optimal work size
+    blas_size_t lwork = -1;
+    std::vector<coeff_t> work(1);
+    auto run = [&]() {
+      if constexpr (is_complex<coeff_t>()) {
+        blaslapack::hetrf(&uplo_, &bn, LILA_BLAS_CAST(coeff_t, fac_.data()),
+                          &lda, ipiv_.data(),
+                          LILA_BLAS_CAST(coeff_t, work.data()), &lwork,
+                          &info_);
+      } else {
+        blaslapack::sytrf(&uplo_, &bn, LILA_BLAS_CAST(coeff_t, fac_.data()),
+                          &lda, ipiv_.data(),
+                          LILA_BLAS_CAST(coeff_t, work.data()), &lwork,
+                          &info_);
+      }
+    };
+    run();
+    assert(info_ == 0);
+    lwork = std::max((blas_size_t)real(work[0]), (blas_size_t)1);
+    work.resize(lwork);
+    run();
+    assert(info_ >= 0);
+  }
+};
+
+} // namespace lila
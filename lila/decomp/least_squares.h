@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/decomp/solve.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+// QR: Householder QR (or LQ for m < n), A must have full rank (gels).
+// SVD: minimum norm solution by divide and conquer SVD (gelsd).
+// PivotedQR: basic solution from a QR decomposition with column pivoting,
+// with at most rank nonzero entries (geqp3).
+enum class LeastSquaresMethod { QR, SVD, PivotedQR };
+
+// LAPACK workspace kept between least-squares solves of similar size, only
+// grows
+template <class coeff_t> struct LeastSquaresWorkspace {
+  std::vector<coeff_t> work;
+  std::vector<coeff_t> tau;
+  std::vector<real_t<coeff_t>> rwork;
+  std::vector<real_t<coeff_t>> s;
+  std::vector<blas_size_t> iwork;
+  std::vector<blas_size_t> jpvt;
+};
+
+namespace detail {
+
+// rcond < 0 selects max(m, n) eps
+template <class coeff_t>
+inline real_t<coeff_t> least_squares_rcond(real_t<coeff_t> rcond,
+                                           lila_size_t m, lila_size_t n) {
+  if (rcond >= 0.)
+    return rcond;
+  return std::max(m, n) * std::numeric_limits<real_t<coeff_t>>::epsilon();
+}
+
+// gels, B has max(m, n) rows
+template <class coeff_t>
+inline lila_size_t least_squares_qr(Matrix<coeff_t> &A, Matrix<coeff_t> &B,
+                                    LeastSquaresWorkspace<coeff_t> &ws) {
+  char trans = 'N';
+  blas_size_t m = A.nrows();
+  blas_size_t n = A.ncols();
+  blas_size_t nrhs = B.ncols();
+  blas_size_t lda = m;
+  blas_size_t ldb = B.nrows();
+  blas_size_t info = 0;
+
+  auto run = [&](coeff_t *work, blas_size_t lwork) {
+    blaslapack::gels(&trans, &m, &n, &nrhs, LILA_BLAS_CAST(coeff_t, A.data()),
+                     &lda, LILA_BLAS_CAST(coeff_t, B.data()), &ldb,
+                     LILA_BLAS_CAST(coeff_t, work), &lwork, &info);
+  };
+
+  // get optimal work size
+  coeff_t work_query = 0.;
+  run(&work_query, -1);
+  assert(info == 0);
+  grow(ws.work, static_cast<blas_size_t>(real(work_query)));
+  run(ws.work.data(), ws.work.size());
+  assert(info == 0); // info > 0: A is rank deficient
+  return std::min(m, n);
+}
+
+// gelsd, B has max(m, n) rows
+template <class coeff_t>
+inline lila_size_t least_squares_svd(Matrix<coeff_t> &A, Matrix<coeff_t> &B,
+                                     LeastSquaresWorkspace<coeff_t> &ws,
+                                     real_t<coeff_t> rcond) {
+  blas_size_t m = A.nrows();
+  blas_size_t n = A.ncols();
+  blas_size_t nrhs = B.ncols();
+  blas_size_t lda = m;
+  blas_size_t ldb = B.nrows();
+  blas_size_t rank = 0;
+  blas_size_t info = 0;
+  grow(ws.s, std::min(m, n));
+
+  auto run = [&](coeff_t *work, blas_size_t lwork, real_t<coeff_t> *rwork,
+                 blas_size_t *iwork) {
+    if constexpr (is_complex<coeff_t>()) {
+      blaslapack::gelsd(&m, &n, &nrhs, LILA_BLAS_CAST(coeff_t, A.data()), &lda,
+                        LILA_BLAS_CAST(coeff_t, B.data()), &ldb, ws.s.data(),
+                        &rcond, &rank, LILA_BLAS_CAST(coeff_t, work), &lwork,
+                        rwork, iwork, &info);
+    } else {
+      (void)rwork;
+      blaslapack::gelsd(&m, &n, &nrhs, LILA_BLAS_CAST(coeff_t, A.data()), &lda,
+                        LILA_BLAS_CAST(coeff_t, B.data()), &ldb, ws.s.data(),
+                        &rcond, &rank, LILA_BLAS_CAST(coeff_t, work), &lwork,
+                        iwork, &info);
+    }
+  };
+
+  // get optimal work size, the query also returns the sizes of rwork and
+  // iwork in their first entries
+  coeff_t work_query = 0.;
+  real_t<coeff_t> rwork_query = 0.;
+  blas_size_t iwork_query = 0;
+  run(&work_query, -1, &rwork_query, &iwork_query);
+  assert(info == 0);
+  grow(ws.work, static_cast<blas_size_t>(real(work_query)));
+  grow(ws.rwork, static_cast<blas_size_t>(rwork_query));
+  grow(ws.iwork, iwork_query);
+  run(ws.work.data(), ws.work.size(), ws.rwork.data(), ws.iwork.data());
+  assert(info == 0); // info > 0: the SVD did not converge
+  return rank;
+}
+
+// geqp3, B has m rows and is replaced by the n x nrhs solution
+template <class coeff_t>
+inline lila_size_t least_squares_pivoted(Matrix<coeff_t> &A,
+                                         Matrix<coeff_t> &B,
+                                         LeastSquaresWorkspace<coeff_t> &ws,
+                                         real_t<coeff_t> rcond) {
+  lila_size_t n = A.ncols();
+  lila_size_t nrhs = B.ncols();
+  lila_size_t k = std::min(A.nrows(), n);
+  grow(ws.tau, k);
+  grow(ws.jpvt, n);
+  if constexpr (is_complex<coeff_t>())
+    grow(ws.rwork, 2 * n);
+  qr_pivot(A, ws.tau.data(), ws.jpvt.data(), ws.work, ws.rwork.data());
+
+  // numerical rank from the non-increasing |R(i, i)|
+  lila_size_t rank = 0;
+  real_t<coeff_t> threshold = rcond * std::abs(A(0, 0));
+  while ((rank < k) && (std::abs(A(rank, rank)) > threshold))
+    ++rank;
+
+  // R_11 X_1 = (Q^H B)(0:rank, :), X = P [X_1; 0]
+  qr_apply_q(A, ws.tau.data(), k, B, 'L', 'C', ws.work);
+  Matrix<coeff_t> X(n, nrhs);
+  if (rank > 0) {
+    SolveTriInplace(A({0, rank}, {0, rank}), B({0, rank}, {0, nrhs}),
+                    coeff_t(1.), 'L', 'U', 'N');
+    for (lila_size_t j = 0; j < nrhs; ++j)
+      for (lila_size_t i = 0; i < rank; ++i)
+        X(ws.jpvt[i] - 1, j) = B(i, j);
+  }
+  B = std::move(X);
+  return rank;
+}
+
+} // namespace detail
+
+// Solves min_X ||A X - B|| for an m x n matrix A, replacing B (m x nrhs) by
+// the n x nrhs solution. Returns the numerical rank of A: singular values
+// (SVD) or |R(i, i)| (PivotedQR) below rcond times the largest one are
+// treated as zero, rcond < 0 selects max(m, n) eps. A is destroyed, ws is
+// only reallocated when the shape grows.
+template <class coeff_t>
+inline lila_size_t
+LeastSquaresInplace(Matrix<coeff_t> &A, Matrix<coeff_t> &B,
+                    LeastSquaresWorkspace<coeff_t> &ws,
+                    LeastSquaresMethod method = LeastSquaresMethod::QR,
+                    real_t<coeff_t> rcond = -1.) {
+  assert(A.nrows() == B.nrows());
+  lila_size_t m = A.nrows();
+  lila_size_t n = A.ncols();
+  lila_size_t nrhs = B.ncols();
+  if ((m == 0) || (n == 0) || (nrhs == 0)) {
+    B = Matrix<coeff_t>(n, nrhs);
+    return 0;
+  }
+  rcond = detail::least_squares_rcond<coeff_t>(rcond, m, n);
+  if (method == LeastSquaresMethod::PivotedQR)
+    return detail::least_squares_pivoted(A, B, ws, rcond);
+
+  // gels and gelsd overwrite B with the solution in its first n rows
+  if (n > m)
+    B.resize(n, nrhs);
+  lila_size_t rank = (method == LeastSquaresMethod::QR)
+                         ? detail::least_squares_qr(A, B, ws)
+                         : detail::least_squares_svd(A, B, ws, rcond);
+  if (m > n)
+    B.resize(n, nrhs);
+  return rank;
+}
+
+template <class coeff_t>
+inline Matrix<coeff_t>
+LeastSquares(Matrix<coeff_t> A, Matrix<coeff_t> B,
+             LeastSquaresMethod method = LeastSquaresMethod::QR,
+             real_t<coeff_t> rcond = -1., lila_size_t *rank = nullptr) {
+  LeastSquaresWorkspace<coeff_t> ws;
+  lila_size_t r = LeastSquaresInplace(A, B, ws, method, rcond);
+  if (rank)
+    *rank = r;
+  return B;
+}
+
+template <class coeff_t>
+inline Vector<coeff_t>
+LeastSquares(Matrix<coeff_t> A, Vector<coeff_t> const &b,
+             LeastSquaresMethod method = LeastSquaresMethod::QR,
+             real_t<coeff_t> rcond = -1., lila_size_t *rank = nullptr) {
+  Matrix<coeff_t> B(b);
+  LeastSquaresWorkspace<coeff_t> ws;
+  lila_size_t r = LeastSquaresInplace(A, B, ws, method, rcond);
+  if (rank)
+    *rank = r;
+  Vector<coeff_t> x(B.nrows());
+  std::copy(B.data(), B.data() + B.nrows(), x.data());
+  return x;
+}
+
+} // namespace lila
@@ -0,0 +1,243 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include <lila/algebra/mult.h>
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/decomp/determinant.h>
+#include <lila/decomp/solve.h>
+#include <lila/matrix.h>
+#include <lila/special/special.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+// Keeps G = A^-1 up to date under low-rank changes of A with the
+// Sherman-Morrison-Woodbury formula, at O(n^2) per rank-1 change instead of
+// O(n^3) for a new inversion. Determinant ratios det A' / det A of proposed
+// row or column replacements cost O(n k).
+//
+// Accepted rank-1 changes are delayed: the current inverse is represented as
+// G - U V^T with k <= max_delay pending columns in U and V, which are folded
+// into G by one gemm (ger for k = 1) once max_delay is reached or on flush().
+// All products are transposes, not adjoints.
+template <class coeff_t> class LowRankUpdater {
+public:
+  LowRankUpdater() = default;
+  explicit LowRankUpdater(Matrix<coeff_t> const &A, lila_size_t max_delay = 16)
+      : U_(A.nrows(), max_delay), V_(A.nrows(), max_delay),
+        max_delay_(max_delay), g_(A.nrows()), w_(A.nrows()), t_(max_delay) {
+    assert(max_delay > 0);
+    reset(A);
+  }
+
+  lila_size_t n() const { return G_.nrows(); }
+  lila_size_t max_delay() const { return max_delay_; }
+  lila_size_t pending() const { return k_; }
+
+  // Discards all updates and inverts A anew, e.g. to remove accumulated
+  // rounding errors
+  void reset(Matrix<coeff_t> const &A) {
+    assert(A.nrows() == A.ncols());
+    assert(A.nrows() == U_.nrows());
+    G_ = A;
+    Invert(G_);
+    k_ = 0;
+  }
+
+  // det A' / det A if row r of A is replaced by u
+  coeff_t ratio_row(lila_size_t r, Vector<coeff_t> const &u) const {
+    assert(u.size() == n());
+    current_column(r, g_.data());
+    return dot(u.data(), g_.data());
+  }
+
+  // det A' / det A if column c of A is replaced by v
+  coeff_t ratio_column(lila_size_t c, Vector<coeff_t> const &v) const {
+    assert(v.size() == n());
+    current_row(c, w_.data());
+    return dot(w_.data(), v.data());
+  }
+
+  // Replaces row r of A by u and returns det A' / det A
+  coeff_t accept_row(lila_size_t r, Vector<coeff_t> const &u) {
+    assert(u.size() == n());
+    lila_size_t n = this->n();
+    current_column(r, g_.data());
+
+    // w = G'^T u = G^T u - V U^T u
+    detail::gemv('T', n, n, coeff_t(1.), G_.data(), n, u.data(), 1,
+                 coeff_t(0.), w_.data(), 1);
+    if (k_ > 0) {
+      detail::gemv('T', n, k_, coeff_t(1.), U_.data(), n, u.data(), 1,
+                   coeff_t(0.), t_.data(), 1);
+      detail::gemv('N', n, k_, coeff_t(-1.), V_.data(), n, t_.data(), 1,
+                   coeff_t(1.), w_.data(), 1);
+    }
+
+    // G'' = G' - G'[:, r] (u^T G' - e_r^T) / ratio
+    coeff_t ratio = w_[r];
+    assert(ratio != coeff_t(0.));
+    w_[r] -= 1.;
+    push(ratio);
+    return ratio;
+  }
+
+  // Replaces column c of A by v and returns det A' / det A
+  coeff_t accept_column(lila_size_t c, Vector<coeff_t> const &v) {
+    assert(v.size() == n());
+    lila_size_t n = this->n();
+    current_row(c, w_.data());
+
+    // g = G' v = G v - U V^T v
+    detail::gemv('N', n, n, coeff_t(1.), G_.data(), n, v.data(), 1,
+                 coeff_t(0.), g_.data(), 1);
+    if (k_ > 0) {
+      detail::gemv('T', n, k_, coeff_t(1.), V_.data(), n, v.data(), 1,
+                   coeff_t(0.), t_.data(), 1);
+      detail::gemv('N', n, k_, coeff_t(-1.), U_.data(), n, t_.data(), 1,
+                   coeff_t(1.), g_.data(), 1);
+    }
+
+    // G'' = G' - (G' v - e_c) G'[c, :] / ratio
+    coeff_t ratio = g_[c];
+    assert(ratio != coeff_t(0.));
+    g_[c] -= 1.;
+    push(ratio);
+    return ratio;
+  }
+
+  // det(A + X Y^T) / det A = det(1 + Y^T G X) for n x m matrices X, Y
+  coeff_t ratio(Matrix<coeff_t> const &X, Matrix<coeff_t> const &Y) const {
+    return Determinant(capacitance(X, Y, current_times(X)));
+  }
+
+  // Replaces A by A + X Y^T and returns det A' / det A. Pending rank-1
+  // updates are flushed first, the update itself costs three gemms.
+  coeff_t accept(Matrix<coeff_t> const &X, Matrix<coeff_t> const &Y) {
+    flush();
+    lila_size_t n = this->n();
+    lila_size_t m = X.ncols();
+    auto GX = current_times(X);
+    auto S = capacitance(X, Y, GX);
+    coeff_t ratio = Determinant(S);
+
+    // G' = G - G X S^-1 Y^T G
+    Matrix<coeff_t> YG(m, n);
+    detail::gemm('T', 'N', m, n, n, coeff_t(1.), Y.data(), n, G_.data(), n,
+                 coeff_t(0.), YG.data(), m);
+    Solve(S, YG);
+    detail::gemm('N', 'N', n, n, m, coeff_t(-1.), GX.data(), n, YG.data(), m,
+                 coeff_t(1.), G_.data(), n);
+    return ratio;
+  }
+
+  // Folds the pending updates into G
+  void flush() {
+    lila_size_t n = this->n();
+    if (k_ == 1) {
+      blas_size_t bn = n;
+      blas_size_t inc = 1;
+      coeff_t alpha = -1.;
+      blaslapack::ger(&bn, &bn, LILA_BLAS_CAST(coeff_t, &alpha),
+                      LILA_BLAS_CAST(coeff_t, U_.data()), &inc,
+                      LILA_BLAS_CAST(coeff_t, V_.data()), &inc,
+                      LILA_BLAS_CAST(coeff_t, G_.data()), &bn);
+    } else if (k_ > 1)
+      detail::gemm('N', 'T', n, n, k_, coeff_t(-1.), U_.data(), n, V_.data(),
+                   n, coeff_t(1.), G_.data(), n);
+    k_ = 0;
+  }
+
+  // The current A^-1
+  Matrix<coeff_t> const &inverse() {
+    flush();
+    return G_;
+  }
+
+private:
+  Matrix<coeff_t> G_;
+  Matrix<coeff_t> U_;
+  Matrix<coeff_t> V_;
+  lila_size_t k_ = 0;
+  lila_size_t max_delay_ = 1;
+
+  // workspace, reused to avoid allocations in the ratio computations
+  mutable std::vector<coeff_t> g_;
+  mutable std::vector<coeff_t> w_;
+  mutable std::vector<coeff_t> t_;
+
+  coeff_t dot(coeff_t const *x, coeff_t const *y) const {
+    coeff_t res = 0.;
+    for (lila_size_t i = 0; i < n(); ++i)
+      res += x[i] * y[i];
+    return res;
+  }
+
+  // col = G[:, r] - U V[r, :]^T
+  void current_column(lila_size_t r, coeff_t *col) const {
+    assert(r < n());
+    lila_size_t n = this->n();
+    std::copy(G_.data() + r * n, G_.data() + (r + 1) * n, col);
+    if (k_ > 0)
+      detail::gemv('N', n, k_, coeff_t(-1.), U_.data(), n, V_.data() + r, n,
+                   coeff_t(1.), col, 1);
+  }
+
+  // row = G[c, :]^T - V U[c, :]^T
+  void current_row(lila_size_t c, coeff_t *row) const {
+    assert(c < n());
+    lila_size_t n = this->n();
+    for (lila_size_t j = 0; j < n; ++j)
+      row[j] = G_(c, j);
+    if (k_ > 0)
+      detail::gemv('N', n, k_, coeff_t(-1.), V_.data(), n, U_.data() + c, n,
+                   coeff_t(1.), row, 1);
+  }
+
+  // (G - U V^T) X
+  Matrix<coeff_t> current_times(Matrix<coeff_t> const &X) const {
+    assert(X.nrows() == n());
+    lila_size_t n = this->n();
+    lila_size_t m = X.ncols();
+    Matrix<coeff_t> GX(n, m);
+    detail::gemm('N', 'N', n, m, n, coeff_t(1.), G_.data(), n, X.data(), n,
+                 coeff_t(0.), GX.data(), n);
+    if (k_ > 0) {
+      Matrix<coeff_t> VX(k_, m);
+      detail::gemm('T', 'N', k_, m, n, coeff_t(1.), V_.data(), n, X.data(), n,
+                   coeff_t(0.), VX.data(), k_);
+      detail::gemm('N', 'N', n, m, k_, coeff_t(-1.), U_.data(), n, VX.data(),
+                   k_, coeff_t(1.), GX.data(), n);
+    }
+    return GX;
+  }
+
+  // 1 + Y^T G X
+  Matrix<coeff_t> capacitance(Matrix<coeff_t> const &X,
+                              Matrix<coeff_t> const &Y,
+                              Matrix<coeff_t> const &GX) const {
+    assert(Y.nrows() == n());
+    assert(Y.ncols() == X.ncols());
+    lila_size_t m = X.ncols();
+    auto S = Identity<coeff_t>(m);
+    detail::gemm('T', 'N', m, m, n(), coeff_t(1.), Y.data(), n(), GX.data(),
+                 n(), coeff_t(1.), S.data(), m);
+    return S;
+  }
+
+  // Appends g / ratio and w as a pending update
+  void push(coeff_t ratio) {
+    lila_size_t n = this->n();
+    for (lila_size_t i = 0; i < n; ++i) {
+      U_(i, k_) = g_[i] / ratio;
+      V_(i, k_) = w_[i];
+    }
+    if (++k_ == max_delay_)
+      flush();
+  }
+};
+
+} // namespace lila
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <lila/algebra/mult.h>
+#include <lila/arithmetic/norm.h>
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/detail/factorization_detail.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+// LU decomposition P A = L U of a square matrix with partial pivoting
+// (getrf), computed once and reused for any number of solves. Constructing
+// from an rvalue factors the matrix in its own storage without a copy.
+template <class coeff_t> class LU {
+public:
+  using real_type = real_t<coeff_t>;
+
+  LU() = default;
+  explicit LU(Matrix<coeff_t> const &A) : lu_(A) { factor(); }
+  explicit LU(Matrix<coeff_t> &&A) : lu_(std::move(A)) { factor(); }
+
+  lila_size_t n() const { return lu_.nrows(); }
+  blas_size_t info() const { return info_; }
+  bool singular() const { return info_ > 0; }
+  Matrix<coeff_t> const &factors() const { return lu_; }
+  std::vector<blas_size_t> const &pivots() const { return ipiv_; }
+
+  // op(A) X = B with trans 'N', 'T' or 'C', B is overwritten by X
+  void solve_inplace(MatrixView<coeff_t> B, char trans = 'N') const {
+    assert(!singular());
+    assert(B.m() == n());
+    blas_size_t bn = n();
+    blas_size_t n_rhs = B.n();
+    blas_size_t lda = detail::blas_ld(lu_);
+    blas_size_t ldb = detail::blas_ld(B);
+    blas_size_t info = 0;
+    blaslapack::getrs(&trans, &bn, &n_rhs,
+                      LILA_BLAS_CONST_CAST(coeff_t, lu_.data()), &lda,
+                      LILA_BLAS_CONST_CAST(blas_size_t, ipiv_.data()),
+                      LILA_BLAS_CAST(coeff_t, B.data()), &ldb, &info);
+    assert(info == 0);
+  }
+
+  void solve_inplace(Matrix<coeff_t> &B, char trans = 'N') const {
+    solve_inplace(MatrixView<coeff_t>(B), trans);
+  }
+
+  void solve_inplace(Vector<coeff_t> &b, char trans = 'N') const {
+    solve_inplace(detail::column_view(b), trans);
+  }
+
+  // b must be contiguous
+  void solve_inplace(VectorView<coeff_t> b, char trans = 'N') const {
+    solve_inplace(detail::column_view(b), trans);
+  }
+
+  // A^-1 B, A^-T B and A^-H B as a new Matrix or Vector, also for a view B,
+  // which is left unchanged
+  template <class vec_t> auto solve(vec_t const &B) const {
+    auto X = detail::owning_copy(B);
+    solve_inplace(X, 'N');
+    return X;
+  }
+
+  template <class vec_t> auto solve_transposed(vec_t const &B) const {
+    auto X = detail::owning_copy(B);
+    solve_inplace(X, 'T');
+    return X;
+  }
+
+  template <class vec_t> auto solve_adjoint(vec_t const &B) const {
+    auto X = detail::owning_copy(B);
+    solve_inplace(X, 'C');
+    return X;
+  }
+
+  // det A = det_sign() * exp(log_det()), det_sign() has modulus one
+  real_type log_det() const { return detail::lu_log_det(lu_, ipiv_).first; }
+  coeff_t det_sign() const { return detail::lu_log_det(lu_, ipiv_).second; }
+  coeff_t det() const { return det_sign() * std::exp(log_det()); }
+
+  Matrix<coeff_t> inverse() const {
+    assert(!singular());
+    Matrix<coeff_t> inv = lu_;
+    blas_size_t bn = n();
+    blas_size_t lda = detail::blas_ld(inv);
+    blas_size_t info = 0;
+    blas_size_t lwork = -1;
+    std::vector<coeff_t> work(1);
+    blaslapack::getri(&bn, LILA_BLAS_CAST(coeff_t, inv.data()), &lda,
+                      LILA_BLAS_CONST_CAST(blas_size_t, ipiv_.data()),
+                      LILA_BLAS_CAST(coeff_t, work.data()), &lwork, &info);
+    lwork = std::max((blas_size_t)real(work[0]), (blas_size_t)1);
+    work.resize(lwork);
+    blaslapack::getri(&bn, LILA_BLAS_CAST(coeff_t, inv.data()), &lda,
+                      LILA_BLAS_CONST_CAST(blas_size_t, ipiv_.data()),
+                      LILA_BLAS_CAST(coeff_t, work.data()), &lwork, &info);
+    assert(info == 0);
+    return inv;
+  }
+
+  // Estimate of the reciprocal condition number in the 1-norm (gecon)
+  real_type rcond() const {
+    if (singular())
+      return 0.;
+    char norm = '1';
+    blas_size_t bn = n();
+    blas_size_t lda = detail::blas_ld(lu_);
+    blas_size_t info = 0;
+    real_type anorm = anorm_;
+    real_type rc = 0.;
+    if constexpr (is_complex<coeff_t>()) {
+      std::vector<coeff_t> work(2 * n());
+      std::vector<real_type> rwork(2 * n());
+      blaslapack::gecon(&norm, &bn, LILA_BLAS_CONST_CAST(coeff_t, lu_.data()),
+                        &lda, &anorm, &rc,
+                        LILA_BLAS_CAST(coeff_t, work.data()), rwork.data(),
+                        &info);
+    } else {
+      std::vector<coeff_t> work(4 * n());
+      std::vector<blas_size_t> iwork(n());
+      blaslapack::gecon(&norm, &bn, LILA_BLAS_CONST_CAST(coeff_t, lu_.data()),
+                        &lda, &anorm, &rc,
+                        LILA_BLAS_CAST(coeff_t, work.data()), iwork.data(),
+                        &info);
+    }
+    assert(info == 0);
+    return rc;
+  }
+
+private:
+  Matrix<coeff_t> lu_;
+  std::vector<blas_size_t> ipiv_;
+  blas_size_t info_ = 0;
+  real_type anorm_ = 0.;
+
+  void factor() {
+    assert(lu_.nrows() == lu_.ncols());
+    anorm_ = Norm1(lu_);
+    blas_size_t bn = n();
+    blas_size_t lda = detail::blas_ld(lu_);
+    ipiv_.resize(n());
+    blaslapack::getrf(&bn, &bn, LILA_BLAS_CAST(coeff_t, lu_.data()), &lda,
+                      ipiv_.data(), &info_);
+    assert(info_ >= 0);
+  }
+};
+
+} // namespace lila
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+#include <lila/algebra/mult.h>
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+namespace detail {
+
+// (log|Pf A|, Pf A / |Pf A|) by Parlett-Reid tridiagonalization with partial
+// pivoting. The rank-2 updates of the trailing matrix are delayed,
+//
+//   A_cur = A + U W^T - W U^T,
+//
+// with columns of A_cur computed on demand by gemv, and applied as two gemms
+// after block_size steps. A is overwritten.
+template <class coeff_t>
+inline std::pair<real_t<coeff_t>, coeff_t>
+log_pfaffian_inplace(Matrix<coeff_t> &A, lila_size_t block_size) {
+  using real_type = real_t<coeff_t>;
+  assert(A.nrows() == A.ncols());
+  assert(block_size > 0);
+  lila_size_t n = A.nrows();
+  real_type log_pf = 0.;
+  coeff_t phase = 1.;
+  if (n % 2 == 1)
+    return {-std::numeric_limits<real_type>::infinity(), coeff_t(0.)};
+
+  coeff_t *a = A.data();
+  Matrix<coeff_t> U(n, block_size);
+  Matrix<coeff_t> W(n, block_size);
+  coeff_t *u = U.data();
+  coeff_t *w = W.data();
+  std::vector<coeff_t> c(n);
+  lila_size_t l = 0;
+
+  for (lila_size_t k = 0; k + 1 < n; k += 2) {
+    // current column k below the diagonal
+    lila_size_t m = n - k - 1;
+    std::copy(a + k + 1 + k * n, a + (k + 1) * n, c.data() + k + 1);
+    if (l > 0) {
+      gemv('N', m, l, coeff_t(1.), u + k + 1, n, w + k, n, coeff_t(1.),
+           c.data() + k + 1, 1);
+      gemv('N', m, l, coeff_t(-1.), w + k + 1, n, u + k, n, coeff_t(1.),
+           c.data() + k + 1, 1);
+    }
+
+    // move the largest element to row k + 1
+    lila_size_t kp = k + 1;
+    for (lila_size_t i = k + 2; i < n; ++i)
+      if (std::abs(c[i]) > std::abs(c[kp]))
+        kp = i;
+    if (kp != k + 1) {
+      for (lila_size_t j = k; j < n; ++j)
+        std::swap(a[k + 1 + j * n], a[kp + j * n]);
+      for (lila_size_t i = k; i < n; ++i)
+        std::swap(a[i + (k + 1) * n], a[i + kp * n]);
+      for (lila_size_t j = 0; j < l; ++j) {
+        std::swap(u[k + 1 + j * n], u[kp + j * n]);
+        std::swap(w[k + 1 + j * n], w[kp + j * n]);
+      }
+      std::swap(c[k + 1], c[kp]);
+      phase = -phase;
+    }
+
+    coeff_t alpha = -c[k + 1]; // A_cur(k, k + 1)
+    if (alpha == coeff_t(0.))
+      return {-std::numeric_limits<real_type>::infinity(), coeff_t(0.)};
+    log_pf += std::log(std::abs(alpha));
+    phase *= alpha / std::abs(alpha);
+    if (k + 2 == n)
+      break;
+
+    // A_cur(k + 2:, k + 2:) += tau a^T - a tau^T with tau = A_cur(k, k + 2:)
+    // / alpha and a = A_cur(k + 2:, k + 1)
+    m = n - k - 2;
+    for (lila_size_t i = k + 2; i < n; ++i) {
+      u[i + l * n] = -c[i] / alpha;
+      w[i + l * n] = a[i + (k + 1) * n];
+    }
+    if (l > 0) {
+      gemv('N', m, l, coeff_t(1.), u + k + 2, n, w + k + 1, n, coeff_t(1.),
+           w + k + 2 + l * n, 1);
+      gemv('N', m, l, coeff_t(-1.), w + k + 2, n, u + k + 1, n, coeff_t(1.),
+           w + k + 2 + l * n, 1);
+    }
+    ++l;
+
+    if (l == block_size) {
+      coeff_t *t = a + k + 2 + (k + 2) * n;
+      gemm('N', 'T', m, m, l, coeff_t(1.), u + k + 2, n, w + k + 2, n,
+           coeff_t(1.), t, n);
+      gemm('N', 'T', m, m, l, coeff_t(-1.), w + k + 2, n, u + k + 2, n,
+           coeff_t(1.), t, n);
+      l = 0;
+    }
+  }
+  return {log_pf, phase};
+}
+
+} // namespace detail
+
+// (log|Pf A|, Pf A / |Pf A|) of a skew-symmetric matrix A (A^T = -A, also
+// for complex A), which does not overflow for large matrices
+template <class coeff_t>
+inline std::pair<real_t<coeff_t>, coeff_t>
+LogPfaffian(Matrix<coeff_t> A, lila_size_t block_size = 32) {
+  return detail::log_pfaffian_inplace(A, block_size);
+}
+
+// Pfaffian of a skew-symmetric matrix, Pf(A)^2 = det(A)
+template <class coeff_t>
+inline coeff_t Pfaffian(Matrix<coeff_t> A, lila_size_t block_size = 32) {
+  auto lp = detail::log_pfaffian_inplace(A, block_size);
+  if (lp.second == coeff_t(0.))
+    return 0.;
+  return lp.second * std::exp(lp.first);
+}
+
+// Pf(A') / Pf(A) for the rank-2 change A' = A + u v^T - v u^T of a
+// skew-symmetric A, given G = A^-1. This is 1 - u^T G v, e.g. replacing row
+// and column r of A by b and -b is u = e_r and v = b - A(r, :)^T.
+template <class coeff_t>
+inline coeff_t PfaffianRatio(Matrix<coeff_t> const &G, Vector<coeff_t> const &u,
+                             Vector<coeff_t> const &v) {
+  assert(G.nrows() == u.size());
+  auto Gv = Mult(G, v);
+  coeff_t res = 1.;
+  for (lila_size_t i = 0; i < u.size(); ++i)
+    res -= u(i) * Gv(i);
+  return res;
+}
+
+// Replaces G = A^-1 by (A + u v^T - v u^T)^-1 in O(n^2) and returns the
+// Pfaffian ratio. With p = G u and q = G v the new inverse is
+// G - (p q^T - q p^T) / (u^T G v - 1), two rank-1 updates.
+template <class coeff_t>
+inline coeff_t PfaffianUpdate(Matrix<coeff_t> &G, Vector<coeff_t> const &u,
+                              Vector<coeff_t> const &v) {
+  assert(G.nrows() == G.ncols());
+  assert(G.nrows() == u.size());
+  assert(G.nrows() == v.size());
+  auto p = Mult(G, u);
+  auto q = Mult(G, v);
+  coeff_t ratio = 1.;
+  for (lila_size_t i = 0; i < u.size(); ++i)
+    ratio -= u(i) * q(i);
+  assert(ratio != coeff_t(0.));
+
+  blas_size_t n = G.nrows();
+  blas_size_t inc = 1;
+  coeff_t alpha = coeff_t(1.) / ratio;
+  blaslapack::ger(&n, &n, LILA_BLAS_CAST(coeff_t, &alpha),
+                  LILA_BLAS_CAST(coeff_t, p.data()), &inc,
+                  LILA_BLAS_CAST(coeff_t, q.data()), &inc,
+                  LILA_BLAS_CAST(coeff_t, G.data()), &n);
+  alpha = -alpha;
+  blaslapack::ger(&n, &n, LILA_BLAS_CAST(coeff_t, &alpha),
+                  LILA_BLAS_CAST(coeff_t, q.data()), &inc,
+                  LILA_BLAS_CAST(coeff_t, p.data()), &inc,
+                  LILA_BLAS_CAST(coeff_t, G.data()), &n);
+  return ratio;
+}
+
+} // namespace lila
@@ -1,5 +1,11 @@
 #pragma once
 
+#include <algorithm>
+#include <complex>
+#include <type_traits>
+#include <vector>
+
+#include <lila/algebra/mult.h>
 #include <lila/blaslapack/blaslapack.h>
 #include <lila/matrix.h>
 #include <lila/special/special.h>
@@ -46,6 +52,78 @@ inline std::vector<blas_size_t> Solve(Matrix<coeff_t> &A, Vector<coeff_t> &X) {
   return ipiv;
 }
 
+namespace detail {
+
+// X = A^-1 B for n_rhs contiguous columns, returns the refinement steps
+template <class coeff_t>
+inline blas_size_t solve_mixed(Matrix<coeff_t> &A, coeff_t const *B,
+                               coeff_t *X, blas_size_t n_rhs) {
+  assert(A.nrows() == A.ncols());
+  blas_size_t n = A.nrows();
+  blas_size_t lda = n;
+  blas_size_t ldb = n;
+  std::vector<blas_size_t> ipiv(n);
+  blas_size_t iter = 0;
+  blas_size_t info = 0;
+
+  if constexpr (std::is_same_v<real_t<coeff_t>, double>) {
+    std::vector<coeff_t> work(n * n_rhs);
+    if constexpr (is_complex<coeff_t>()) {
+      std::vector<std::complex<float>> swork(n * (n + n_rhs));
+      std::vector<double> rwork(n);
+      blaslapack::gesv_mixed(
+          &n, &n_rhs, LILA_BLAS_CAST(coeff_t, A.data()), &lda, ipiv.data(),
+          LILA_BLAS_CONST_CAST(coeff_t, B), &ldb, LILA_BLAS_CAST(coeff_t, X),
+          &ldb, LILA_BLAS_CAST(coeff_t, work.data()),
+          LILA_BLAS_CAST(std::complex<float>, swork.data()), rwork.data(),
+          &iter, &info);
+    } else {
+      std::vector<float> swork(n * (n + n_rhs));
+      blaslapack::gesv_mixed(
+          &n, &n_rhs, LILA_BLAS_CAST(coeff_t, A.data()), &lda, ipiv.data(),
+          LILA_BLAS_CONST_CAST(coeff_t, B), &ldb, LILA_BLAS_CAST(coeff_t, X),
+          &ldb, LILA_BLAS_CAST(coeff_t, work.data()),
+          LILA_BLAS_CAST(float, swork.data()), &iter, &info);
+    }
+  } else {
+    // no lower precision available, plain LU solve
+    std::copy(B, B + n * n_rhs, X);
+    blaslapack::gesv(&n, &n_rhs, LILA_BLAS_CAST(coeff_t, A.data()), &lda,
+                     ipiv.data(), LILA_BLAS_CAST(coeff_t, X), &ldb, &info);
+  }
+  assert(info == 0);
+  return iter;
+}
+
+} // namespace detail
+
+// X = A^-1 B, where A is LU factored in single precision and X refined to
+// double precision accuracy by iterative refinement (dsgesv / zcgesv). If
+// refinement does not converge a double precision LU is used instead. If
+// given, iter is set to the number of refinement steps, or to a negative
+// value on fallback. Single precision types are solved by a plain gesv.
+template <class coeff_t>
+inline Matrix<coeff_t> SolveMixed(Matrix<coeff_t> A, Matrix<coeff_t> const &B,
+                                  blas_size_t *iter = nullptr) {
+  assert(A.nrows() == B.nrows());
+  Matrix<coeff_t> X(B.nrows(), B.ncols());
+  blas_size_t it = detail::solve_mixed(A, B.data(), X.data(), B.ncols());
+  if (iter)
+    *iter = it;
+  return X;
+}
+
+template <class coeff_t>
+inline Vector<coeff_t> SolveMixed(Matrix<coeff_t> A, Vector<coeff_t> const &b,
+                                  blas_size_t *iter = nullptr) {
+  assert(A.nrows() == b.n());
+  Vector<coeff_t> x(b.n());
+  blas_size_t it = detail::solve_mixed(A, b.data(), x.data(), 1);
+  if (iter)
+    *iter = it;
+  return x;
+}
+
 template <class coeff_t>
 inline std::vector<blas_size_t> LUDecompose(Matrix<coeff_t> &A) {
 
@@ -112,13 +190,21 @@ template <class coeff_t> inline void Invert(Matrix<coeff_t> &A) {
   blas_size_t n = A.nrows();
 
   std::vector<blas_size_t> ipiv(n);
-  blas_size_t lwork = n * n;
-  std::vector<coeff_t> work(lwork);
   blas_size_t info = 0;
 
   blaslapack::getrf(&n, &n, LILA_BLAS_CAST(coeff_t, A.data()), &n, ipiv.data(),
                     &info);
   assert(info == 0);
+
+  // get optimal work size
+  blas_size_t lwork = -1;
+  std::vector<coeff_t> work(1);
+  blaslapack::getri(&n, LILA_BLAS_CAST(coeff_t, A.data()), &n, ipiv.data(),
+                    LILA_BLAS_CAST(coeff_t, work.data()), &lwork, &info);
+  assert(info == 0);
+  lwork = std::max<blas_size_t>(static_cast<blas_size_t>(real(work[0])), 1);
+  work.resize(lwork);
+
   blaslapack::getri(&n, LILA_BLAS_CAST(coeff_t, A.data()), &n, ipiv.data(),
                     LILA_BLAS_CAST(coeff_t, work.data()), &lwork, &info);
   assert(info == 0);
@@ -184,6 +270,109 @@ inline Matrix<coeff_t> QRGetQ(Matrix<coeff_t> &A,
   return Q;
 }
 
+namespace detail {
+
+template <class T> inline void grow(std::vector<T> &work, blas_size_t size) {
+  if (work.size() < (size_t)std::max(size, (blas_size_t)1))
+    work.resize(std::max(size, (blas_size_t)1));
+}
+
+// ormqr with the first k reflectors of (A, tau), work only grows
+template <class coeff_t>
+inline void qr_apply_q(Matrix<coeff_t> const &A, coeff_t const *tau,
+                       blas_size_t k, Matrix<coeff_t> &X, char side,
+                       char trans, std::vector<coeff_t> &work) {
+  assert((side == 'L') || (side == 'R'));
+  assert((trans == 'N') || (trans == 'C') || (trans == 'T'));
+  blas_size_t m = X.nrows();
+  blas_size_t n = X.ncols();
+  blas_size_t lda = std::max<blas_size_t>(A.nrows(), 1);
+  blas_size_t ldc = std::max<blas_size_t>(m, 1);
+  assert(A.nrows() == ((side == 'L') ? m : n));
+  assert(k <= std::min(A.nrows(), A.ncols()));
+  if (trans != 'N')
+    trans = is_complex<coeff_t>() ? 'C' : 'T';
+  blas_size_t info = 0;
+
+  auto run = [&](coeff_t *w, blas_size_t lwork) {
+    blaslapack::ormqr(&side, &trans, &m, &n, &k,
+                      LILA_BLAS_CONST_CAST(coeff_t, A.data()), &lda,
+                      LILA_BLAS_CONST_CAST(coeff_t, tau),
+                      LILA_BLAS_CAST(coeff_t, X.data()), &ldc,
+                      LILA_BLAS_CAST(coeff_t, w), &lwork, &info);
+  };
+
+  // get optimal work size
+  coeff_t work_query = 0.;
+  run(&work_query, -1);
+  assert(info == 0);
+  grow(work, static_cast<blas_size_t>(real(work_query)));
+  run(work.data(), work.size());
+  assert(info == 0);
+}
+
+// geqp3 with all columns free, tau has min(m, n) entries and rwork 2 n
+// entries for complex types
+template <class coeff_t>
+inline void qr_pivot(Matrix<coeff_t> &A, coeff_t *tau, blas_size_t *jpvt,
+                     std::vector<coeff_t> &work, real_t<coeff_t> *rwork) {
+  blas_size_t m = A.nrows();
+  blas_size_t n = A.ncols();
+  blas_size_t lda = std::max<blas_size_t>(m, 1);
+  blas_size_t info = 0;
+  std::fill(jpvt, jpvt + n, 0);
+
+  auto run = [&](coeff_t *w, blas_size_t lwork) {
+    if constexpr (is_complex<coeff_t>()) {
+      blaslapack::geqp3(&m, &n, LILA_BLAS_CAST(coeff_t, A.data()), &lda, jpvt,
+                        LILA_BLAS_CAST(coeff_t, tau),
+                        LILA_BLAS_CAST(coeff_t, w), &lwork, rwork, &info);
+    } else {
+      (void)rwork;
+      blaslapack::geqp3(&m, &n, LILA_BLAS_CAST(coeff_t, A.data()), &lda, jpvt,
+                        LILA_BLAS_CAST(coeff_t, tau),
+                        LILA_BLAS_CAST(coeff_t, w), &lwork, &info);
+    }
+  };
+
+  // get optimal work size
+  coeff_t work_query = 0.;
+  run(&work_query, -1);
+  assert(info == 0);
+  grow(work, static_cast<blas_size_t>(real(work_query)));
+  run(work.data(), work.size());
+  assert(info == 0);
+}
+
+} // namespace detail
+
+// Multiplies X in place by the m x m matrix Q of a QR decomposition (A, tau)
+// as returned by QRDecompose, without forming Q: X = op(Q) X for side 'L'
+// and X = X op(Q) for side 'R', with op(Q) = Q (trans 'N') or Q^H (trans 'C'
+// or 'T'). For Q^H B with B of size m x p this costs O(m p k) instead of the
+// O(m k^2) to form Q plus the multiplication.
+template <class coeff_t>
+inline void QRApplyQ(Matrix<coeff_t> const &A, std::vector<coeff_t> const &tau,
+                     Matrix<coeff_t> &X, char side = 'L', char trans = 'N') {
+  std::vector<coeff_t> work;
+  detail::qr_apply_q(A, tau.data(), tau.size(), X, side, trans, work);
+}
+
+// Rank-revealing QR decomposition A P = Q R with column pivoting (geqp3),
+// stored like QRDecompose. Column j of A P is column jpvt[j] - 1 of A, and
+// |R(i, i)| is non-increasing, so the numerical rank is the number of
+// diagonal entries above a threshold relative to |R(0, 0)|.
+template <class coeff_t>
+inline std::vector<coeff_t> QRPivotDecompose(Matrix<coeff_t> &A,
+                                             std::vector<blas_size_t> &jpvt) {
+  std::vector<coeff_t> tau(std::min(A.nrows(), A.ncols()));
+  std::vector<coeff_t> work;
+  std::vector<real_t<coeff_t>> rwork(2 * A.ncols());
+  jpvt.resize(A.ncols());
+  detail::qr_pivot(A, tau.data(), jpvt.data(), work, rwork.data());
+  return tau;
+}
+
 template <class coeff_t> inline Matrix<coeff_t> GetUpper(Matrix<coeff_t> &A) {
   blas_size_t m = A.nrows();
   blas_size_t n = A.ncols();
@@ -198,4 +387,59 @@ template <class coeff_t> inline Matrix<coeff_t> GetUpper(Matrix<coeff_t> &A) {
   return R;
 }
 
+// B = alpha op(A)^-1 B (side 'L') or B = alpha B op(A)^-1 (side 'R') for a
+// triangular A, of which only the uplo triangle is referenced (trsm). diag
+// 'U' assumes a unit diagonal.
+template <class coeff_t>
+inline void SolveTriInplace(MatrixView<coeff_t> const &A,
+                            MatrixView<coeff_t> B, coeff_t alpha = 1.,
+                            char side = 'L', char uplo = 'U',
+                            char trans = 'N', char diag = 'N') {
+  blas_size_t m = B.m();
+  blas_size_t n = B.n();
+  assert(A.m() == A.n());
+  assert(A.m() == ((side == 'L') ? B.m() : B.n()));
+  blas_size_t lda = detail::blas_ld(A);
+  blas_size_t ldb = detail::blas_ld(B);
+  blaslapack::trsm(&side, &uplo, &trans, &diag, &m, &n,
+                   LILA_BLAS_CAST(coeff_t, &alpha),
+                   LILA_BLAS_CONST_CAST(coeff_t, A.data()), &lda,
+                   LILA_BLAS_CAST(coeff_t, B.data()), &ldb);
+}
+
+template <class coeff_t>
+inline void SolveTriInplace(Matrix<coeff_t> const &A, Matrix<coeff_t> &B,
+                            coeff_t alpha = 1., char side = 'L',
+                            char uplo = 'U', char trans = 'N',
+                            char diag = 'N') {
+  SolveTriInplace(MatrixView<coeff_t>(A), MatrixView<coeff_t>(B), alpha,
+                  side, uplo, trans, diag);
+}
+
+template <class coeff_t>
+inline void SolveTriInplace(Matrix<coeff_t> const &A, Vector<coeff_t> &X,
+                            coeff_t alpha = 1., char uplo = 'U',
+                            char trans = 'N', char diag = 'N') {
+  SolveTriInplace(MatrixView<coeff_t>(A), detail::column_view(X), alpha, 'L',
+                  uplo, trans, diag);
+}
+
+template <class coeff_t>
+inline Matrix<coeff_t> SolveTri(Matrix<coeff_t> const &A,
+                                Matrix<coeff_t> const &B, char side = 'L',
+                                char uplo = 'U', char trans = 'N') {
+  auto X = B;
+  SolveTriInplace(A, X, coeff_t(1.), side, uplo, trans);
+  return X;
+}
+
+template <class coeff_t>
+inline Vector<coeff_t> SolveTri(Matrix<coeff_t> const &A,
+                                Vector<coeff_t> const &B, char uplo = 'U',
+                                char trans = 'N') {
+  auto X = B;
+  SolveTriInplace(A, X, coeff_t(1.), uplo, trans);
+  return X;
+}
+
 } // namespace lila
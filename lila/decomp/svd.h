@@ -0,0 +1,328 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <tuple>
+#include <vector>
+
+#include <lila/algebra/mult.h>
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/decomp/solve.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/special/random.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+enum class SVDMethod { DivideAndConquer, QRIteration };
+
+// LAPACK workspace kept between SVDs of similar size, only grows. The
+// matrices are the sketch buffers of RandomizedSVDInplace, reallocated only
+// when their shape changes.
+template <class coeff_t> struct SVDWorkspace {
+  std::vector<coeff_t> work;
+  std::vector<real_t<coeff_t>> rwork;
+  std::vector<blas_size_t> iwork;
+  std::vector<coeff_t> tau;
+  Matrix<coeff_t> Omega;
+  Matrix<coeff_t> Y;
+  Matrix<coeff_t> Z;
+  Matrix<coeff_t> B;
+  Matrix<coeff_t> Ub;
+  Vector<real_t<coeff_t>> s;
+  Matrix<coeff_t> Vh;
+};
+
+namespace detail {
+
+// Shapes A as m x n within its storage, the entries are overwritten later
+template <class coeff_t>
+inline void reshape(Matrix<coeff_t> &A, lila_size_t m, lila_size_t n) {
+  if ((A.nrows() != m) || (A.ncols() != n))
+    A.resize(m, n);
+}
+
+// gesdd (jobz = job) or gesvd (jobu = jobvt = job) with job 'A', 'S' or 'N'
+template <class coeff_t>
+inline void svd_lapack(char job, Matrix<coeff_t> &A, real_t<coeff_t> *s,
+                       coeff_t *U, blas_size_t ldu, coeff_t *Vh,
+                       blas_size_t ldvt, SVDMethod method,
+                       SVDWorkspace<coeff_t> &ws) {
+  blas_size_t m = A.nrows();
+  blas_size_t n = A.ncols();
+  blas_size_t k = std::min(m, n);
+  blas_size_t mx = std::max(m, n);
+  blas_size_t lda = std::max(m, (blas_size_t)1);
+  blas_size_t info = 0;
+  bool dc = (method == SVDMethod::DivideAndConquer);
+
+  if (dc) {
+    grow(ws.iwork, 8 * k);
+    if (job == 'N')
+      grow(ws.rwork, 7 * k);
+    else
+      grow(ws.rwork, std::max(5 * k * k + 5 * k, 2 * mx * k + 2 * k * k + k));
+  } else
+    grow(ws.rwork, 5 * k);
+
+  auto run = [&](coeff_t *work, blas_size_t lwork) {
+    if (dc) {
+      if constexpr (is_complex<coeff_t>()) {
+        blaslapack::gesdd(&job, &m, &n, LILA_BLAS_CAST(coeff_t, A.data()),
+                          &lda, s, LILA_BLAS_CAST(coeff_t, U), &ldu,
+                          LILA_BLAS_CAST(coeff_t, Vh), &ldvt,
+                          LILA_BLAS_CAST(coeff_t, work), &lwork,
+                          ws.rwork.data(), ws.iwork.data(), &info);
+      } else {
+        blaslapack::gesdd(&job, &m, &n, LILA_BLAS_CAST(coeff_t, A.data()),
+                          &lda, s, LILA_BLAS_CAST(coeff_t, U), &ldu,
+                          LILA_BLAS_CAST(coeff_t, Vh), &ldvt,
+                          LILA_BLAS_CAST(coeff_t, work), &lwork,
+                          ws.iwork.data(), &info);
+      }
+    } else {
+      if constexpr (is_complex<coeff_t>()) {
+        blaslapack::gesvd(&job, &job, &m, &n,
+                          LILA_BLAS_CAST(coeff_t, A.data()), &lda, s,
+                          LILA_BLAS_CAST(coeff_t, U), &ldu,
+                          LILA_BLAS_CAST(coeff_t, Vh), &ldvt,
+                          LILA_BLAS_CAST(coeff_t, work), &lwork,
+                          ws.rwork.data(), &info);
+      } else {
+        blaslapack::gesvd(&job, &job, &m, &n,
+                          LILA_BLAS_CAST(coeff_t, A.data()), &lda, s,
+                          LILA_BLAS_CAST(coeff_t, U), &ldu,
+                          LILA_BLAS_CAST(coeff_t, Vh), &ldvt,
+                          LILA_BLAS_CAST(coeff_t, work), &lwork, &info);
+      }
+    }
+  };
+
+  // get optimal work size
+  coeff_t work_query = 0.;
+  run(&work_query, -1);
+  assert(info == 0);
+  blas_size_t lwork = static_cast<blas_size_t>(real(work_query));
+  grow(ws.work, lwork);
+  lwork = ws.work.size();
+
+  run(ws.work.data(), lwork);
+  assert(info == 0);
+}
+
+// Keeps the first r singular triplets, within the existing storage
+template <class coeff_t>
+inline void svd_truncate(Matrix<coeff_t> &U, Vector<real_t<coeff_t>> &s,
+                         Matrix<coeff_t> &Vh, lila_size_t r) {
+  if (r == s.size())
+    return;
+  U.resize(U.nrows(), r);
+  s.resize(r);
+  Vh.resize(r, Vh.ncols());
+}
+
+// Overwrites Y (m >= columns) by an orthonormal basis of its column space,
+// geqrf and orgqr in place, tau and work only grow
+template <class coeff_t>
+inline void orthonormalize_inplace(Matrix<coeff_t> &Y,
+                                   std::vector<coeff_t> &tau,
+                                   std::vector<coeff_t> &work) {
+  blas_size_t m = Y.nrows();
+  blas_size_t k = Y.ncols();
+  blas_size_t lda = std::max<blas_size_t>(m, 1);
+  blas_size_t info = 0;
+  assert(m >= k);
+  grow(tau, k);
+
+  auto run = [&](coeff_t *w, blas_size_t lwork, bool form_q) {
+    if (form_q)
+      blaslapack::orgqr(&m, &k, &k, LILA_BLAS_CAST(coeff_t, Y.data()), &lda,
+                        LILA_BLAS_CAST(coeff_t, tau.data()),
+                        LILA_BLAS_CAST(coeff_t, w), &lwork, &info);
+    else
+      blaslapack::geqrf(&m, &k, LILA_BLAS_CAST(coeff_t, Y.data()), &lda,
+                        LILA_BLAS_CAST(coeff_t, tau.data()),
+                        LILA_BLAS_CAST(coeff_t, w), &lwork, &info);
+  };
+
+  // get optimal work size for both geqrf and orgqr
+  coeff_t work_query = 0.;
+  run(&work_query, -1, false);
+  assert(info == 0);
+  grow(work, static_cast<blas_size_t>(real(work_query)));
+  run(&work_query, -1, true);
+  assert(info == 0);
+  grow(work, static_cast<blas_size_t>(real(work_query)));
+
+  run(work.data(), work.size(), false);
+  assert(info == 0);
+  run(work.data(), work.size(), true);
+  assert(info == 0);
+}
+
+} // namespace detail
+
+// A = U diag(s) Vh with the singular values s in descending order. For
+// economy U is m x k and Vh is k x n with k = min(m, n), otherwise both are
+// square. A is destroyed, U, s, Vh and ws are only reallocated when their
+// storage has to grow, so repeated calls with equal shapes do not allocate.
+template <class coeff_t>
+inline void SVDInplace(Matrix<coeff_t> &A, Matrix<coeff_t> &U,
+                       Vector<real_t<coeff_t>> &s, Matrix<coeff_t> &Vh,
+                       SVDWorkspace<coeff_t> &ws, bool economy = true,
+                       SVDMethod method = SVDMethod::DivideAndConquer) {
+  lila_size_t m = A.nrows();
+  lila_size_t n = A.ncols();
+  lila_size_t k = std::min(m, n);
+  detail::reshape(U, m, economy ? k : m);
+  detail::reshape(Vh, economy ? k : n, n);
+  if (s.size() != k)
+    s.resize(k);
+  if (k == 0)
+    return;
+  detail::svd_lapack(economy ? 'S' : 'A', A, s.data(), U.data(),
+                     detail::blas_ld(U), Vh.data(), detail::blas_ld(Vh),
+                     method, ws);
+}
+
+template <class coeff_t>
+inline std::tuple<Matrix<coeff_t>, Vector<real_t<coeff_t>>, Matrix<coeff_t>>
+SVD(Matrix<coeff_t> A, bool economy = true,
+    SVDMethod method = SVDMethod::DivideAndConquer) {
+  Matrix<coeff_t> U;
+  Vector<real_t<coeff_t>> s;
+  Matrix<coeff_t> Vh;
+  SVDWorkspace<coeff_t> ws;
+  SVDInplace(A, U, s, Vh, ws, economy, method);
+  return {U, s, Vh};
+}
+
+template <class coeff_t>
+inline Vector<real_t<coeff_t>> SingularValues(Matrix<coeff_t> A) {
+  Vector<real_t<coeff_t>> s(std::min(A.nrows(), A.ncols()));
+  if (s.size() == 0)
+    return s;
+  SVDWorkspace<coeff_t> ws;
+  coeff_t dummy = 0.;
+  detail::svd_lapack('N', A, s.data(), &dummy, 1, &dummy, 1,
+                     SVDMethod::DivideAndConquer, ws);
+  return s;
+}
+
+// Economy SVD truncated to at most max_rank singular values. The smallest
+// ones are dropped as long as the discarded weight sum_i s_i^2 / sum_j s_j^2
+// stays below cutoff, at least one value is kept. Returns the discarded
+// weight, which for a normalized MPS is the truncation error.
+template <class coeff_t>
+inline real_t<coeff_t>
+TruncatedSVDInplace(Matrix<coeff_t> &A, Matrix<coeff_t> &U,
+                    Vector<real_t<coeff_t>> &s, Matrix<coeff_t> &Vh,
+                    SVDWorkspace<coeff_t> &ws, lila_size_t max_rank,
+                    real_t<coeff_t> cutoff = 0.,
+                    SVDMethod method = SVDMethod::DivideAndConquer) {
+  using real_type = real_t<coeff_t>;
+  SVDInplace(A, U, s, Vh, ws, true, method);
+  lila_size_t k = s.size();
+  if (k == 0)
+    return 0.;
+  real_type total = 0.;
+  for (auto x : s)
+    total += x * x;
+  if (total == 0.)
+    total = 1.;
+
+  lila_size_t r = std::max(std::min(k, max_rank), (lila_size_t)1);
+  real_type discarded = 0.;
+  for (lila_size_t i = r; i < k; ++i)
+    discarded += s(i) * s(i);
+  while ((r > 1) && (discarded + s(r - 1) * s(r - 1) <= cutoff * total)) {
+    --r;
+    discarded += s(r) * s(r);
+  }
+  detail::svd_truncate(U, s, Vh, r);
+  return discarded / total;
+}
+
+template <class coeff_t>
+inline std::tuple<Matrix<coeff_t>, Vector<real_t<coeff_t>>, Matrix<coeff_t>>
+TruncatedSVD(Matrix<coeff_t> A, lila_size_t max_rank,
+             real_t<coeff_t> cutoff = 0.,
+             real_t<coeff_t> *discarded_weight = nullptr,
+             SVDMethod method = SVDMethod::DivideAndConquer) {
+  Matrix<coeff_t> U;
+  Vector<real_t<coeff_t>> s;
+  Matrix<coeff_t> Vh;
+  SVDWorkspace<coeff_t> ws;
+  auto discarded =
+      TruncatedSVDInplace(A, U, s, Vh, ws, max_rank, cutoff, method);
+  if (discarded_weight)
+    *discarded_weight = discarded;
+  return {U, s, Vh};
+}
+
+// Approximate leading rank singular triplets (Halko, Martinsson, Tropp): the
+// range of A is sampled with a Gaussian sketch of rank + oversampling
+// columns drawn from gen, sharpened by power_iterations passes with A A^H
+// (reorthonormalized by QR in between) and the SVD of the small projected
+// matrix Q^H A is lifted back. Costs O(m n (rank + oversampling)) gemm work.
+// All intermediate matrices live in ws, so repeated calls with equal shapes
+// do not allocate.
+template <class coeff_t, class gen_t>
+inline void RandomizedSVDInplace(Matrix<coeff_t> const &A, Matrix<coeff_t> &U,
+                                 Vector<real_t<coeff_t>> &s,
+                                 Matrix<coeff_t> &Vh, SVDWorkspace<coeff_t> &ws,
+                                 lila_size_t rank, gen_t &gen,
+                                 lila_size_t oversampling = 10,
+                                 lila_size_t power_iterations = 2) {
+  lila_size_t m = A.nrows();
+  lila_size_t n = A.ncols();
+  lila_size_t l = std::min(rank + oversampling, std::min(m, n));
+  assert(rank <= l);
+
+  // Q is kept in ws.Y
+  detail::reshape(ws.Omega, n, l);
+  Random(ws.Omega, gen);
+  Mult(A, ws.Omega, ws.Y);
+  detail::orthonormalize_inplace(ws.Y, ws.tau, ws.work);
+  for (lila_size_t it = 0; it < power_iterations; ++it) {
+    Mult(A, ws.Y, ws.Z, coeff_t(1.), coeff_t(0.), 'C', 'N');
+    detail::orthonormalize_inplace(ws.Z, ws.tau, ws.work);
+    Mult(A, ws.Z, ws.Y);
+    detail::orthonormalize_inplace(ws.Y, ws.tau, ws.work);
+  }
+
+  // B = Q^H A = Ub diag(s) Vh, U = Q Ub, keeping the first rank triplets
+  Mult(ws.Y, A, ws.B, coeff_t(1.), coeff_t(0.), 'C', 'N');
+  SVDInplace(ws.B, ws.Ub, ws.s, ws.Vh, ws, true);
+  detail::reshape(U, m, rank);
+  detail::reshape(Vh, rank, n);
+  if (s.size() != rank)
+    s.resize(rank);
+  if (rank == 0)
+    return;
+  detail::gemm('N', 'N', m, rank, l, coeff_t(1.), ws.Y.data(), m,
+               ws.Ub.data(), l, coeff_t(0.), U.data(), m);
+  std::copy(ws.s.begin(), ws.s.begin() + rank, s.begin());
+  for (lila_size_t j = 0; j < n; ++j)
+    std::copy(ws.Vh.data() + j * l, ws.Vh.data() + j * l + rank,
+              Vh.data() + j * rank);
+}
+
+template <class coeff_t>
+inline std::tuple<Matrix<coeff_t>, Vector<real_t<coeff_t>>, Matrix<coeff_t>>
+RandomizedSVD(Matrix<coeff_t> const &A, lila_size_t rank,
+              lila_size_t oversampling = 10, lila_size_t power_iterations = 2,
+              int seed = 0) {
+  normal_dist_t<coeff_t> dist(0., 1.);
+  normal_gen_t<coeff_t> gen(dist, seed);
+  Matrix<coeff_t> U;
+  Vector<real_t<coeff_t>> s;
+  Matrix<coeff_t> Vh;
+  SVDWorkspace<coeff_t> ws;
+  RandomizedSVDInplace(A, U, s, Vh, ws, rank, gen, oversampling,
+                       power_iterations);
+  return {U, s, Vh};
+}
+
+} // namespace lila
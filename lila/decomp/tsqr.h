@@ -0,0 +1,262 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <utility>
+#include <vector>
+
+#include <lila/algebra/mult.h>
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/common.h>
+#include <lila/decomp/cholesky.h>
+#include <lila/decomp/solve.h>
+#include <lila/matrix.h>
+#include <lila/special/special.h>
+
+namespace lila {
+
+namespace detail {
+
+// Row offsets of the chunks of an m x k matrix, each chunk has at least
+// max(chunk_rows, k) rows and the last one takes the remainder
+inline std::vector<lila_size_t>
+tsqr_offsets(lila_size_t m, lila_size_t k, lila_size_t chunk_rows) {
+  if (chunk_rows == 0)
+    chunk_rows = std::max<lila_size_t>(1 << 14, 8 * k);
+  chunk_rows = std::max<lila_size_t>({chunk_rows, k, 1});
+  lila_size_t nchunks = std::max<lila_size_t>(m / chunk_rows, 1);
+  std::vector<lila_size_t> offsets(nchunks + 1);
+  for (lila_size_t i = 0; i < nchunks; ++i)
+    offsets[i] = i * chunk_rows;
+  offsets[nchunks] = m;
+  return offsets;
+}
+
+// Thin QR of the m x k block at a (m >= k) in place: the block is
+// overwritten by the explicit Q and R is returned
+template <class coeff_t>
+inline Matrix<coeff_t> qr_explicit_inplace(coeff_t *a, blas_size_t m,
+                                           blas_size_t k, blas_size_t lda) {
+  std::vector<coeff_t> tau(k);
+  blas_size_t info = 0;
+
+  // get optimal work size for both geqrf and orgqr
+  blas_size_t lwork = -1;
+  coeff_t query = 0.;
+  blaslapack::geqrf(&m, &k, LILA_BLAS_CAST(coeff_t, a), &lda,
+                    LILA_BLAS_CAST(coeff_t, tau.data()),
+                    LILA_BLAS_CAST(coeff_t, &query), &lwork, &info);
+  assert(info == 0);
+  blas_size_t size = static_cast<blas_size_t>(real(query));
+  blaslapack::orgqr(&m, &k, &k, LILA_BLAS_CAST(coeff_t, a), &lda,
+                    LILA_BLAS_CAST(coeff_t, tau.data()),
+                    LILA_BLAS_CAST(coeff_t, &query), &lwork, &info);
+  assert(info == 0);
+  lwork = std::max<blas_size_t>(
+      {size, static_cast<blas_size_t>(real(query)), 1});
+  std::vector<coeff_t> work(lwork);
+
+  blaslapack::geqrf(&m, &k, LILA_BLAS_CAST(coeff_t, a), &lda,
+                    LILA_BLAS_CAST(coeff_t, tau.data()),
+                    LILA_BLAS_CAST(coeff_t, work.data()), &lwork, &info);
+  assert(info == 0);
+  Matrix<coeff_t> R(k, k);
+  for (blas_size_t j = 0; j < k; ++j)
+    for (blas_size_t i = 0; i <= j; ++i)
+      R(i, j) = a[i + j * lda];
+  blaslapack::orgqr(&m, &k, &k, LILA_BLAS_CAST(coeff_t, a), &lda,
+                    LILA_BLAS_CAST(coeff_t, tau.data()),
+                    LILA_BLAS_CAST(coeff_t, work.data()), &lwork, &info);
+  assert(info == 0);
+  return R;
+}
+
+} // namespace detail
+
+// Communication-avoiding QR A = Q R of a tall-skinny m x k matrix (m >= k).
+// The rows are split into chunks which are factored independently, and the
+// k x k R factors are combined pairwise in a binary reduction tree. Each
+// level of the tree runs in parallel with OpenMP.
+//
+// Q is kept implicitly as the tree of explicit factors: one m_i x k matrix
+// per chunk (stored in place of A) and one 2k x k matrix per tree node, so
+// applying Q or Q^H costs a gemm per factor. Chunks have at least
+// max(chunk_rows, k) rows, by default chunk_rows = max(2^14, 8 k).
+template <class coeff_t> class TSQR {
+public:
+  TSQR() = default;
+  explicit TSQR(Matrix<coeff_t> A, lila_size_t chunk_rows = 0)
+      : leaves_(std::move(A)) {
+    lila_size_t m = leaves_.nrows();
+    lila_size_t k = leaves_.ncols();
+    assert(m >= k);
+    offsets_ = detail::tsqr_offsets(m, k, chunk_rows);
+    lila_size_t nchunks = offsets_.size() - 1;
+
+    std::vector<Matrix<coeff_t>> R(nchunks);
+    coeff_t *a = leaves_.data();
+    LILA_OMP(omp parallel for if (nchunks > 1))
+    for (lila_size_t i = 0; i < nchunks; ++i)
+      R[i] = detail::qr_explicit_inplace(a + offsets_[i],
+                                         offsets_[i + 1] - offsets_[i], k, m);
+
+    // reduce [R_2j; R_2j+1] = Q_j R_j level by level, an unpaired last R is
+    // passed up unchanged and its node keeps an empty Q
+    while (R.size() > 1) {
+      lila_size_t nodes = (R.size() + 1) / 2;
+      std::vector<Matrix<coeff_t>> Rnext(nodes);
+      std::vector<Matrix<coeff_t>> Q(nodes);
+      LILA_OMP(omp parallel for if (nodes > 1))
+      for (lila_size_t j = 0; j < nodes; ++j) {
+        if (2 * j + 1 == (lila_size_t)R.size()) {
+          Rnext[j] = std::move(R[2 * j]);
+          continue;
+        }
+        Matrix<coeff_t> S(2 * k, k);
+        for (lila_size_t c = 0; c < k; ++c)
+          for (lila_size_t r = 0; r < k; ++r) {
+            S(r, c) = R[2 * j](r, c);
+            S(k + r, c) = R[2 * j + 1](r, c);
+          }
+        Rnext[j] = detail::qr_explicit_inplace(S.data(), 2 * k, k, 2 * k);
+        Q[j] = std::move(S);
+      }
+      tree_.push_back(std::move(Q));
+      R = std::move(Rnext);
+    }
+    R_ = std::move(R[0]);
+  }
+
+  lila_size_t nrows() const { return leaves_.nrows(); }
+  lila_size_t ncols() const { return leaves_.ncols(); }
+  lila_size_t nchunks() const { return offsets_.size() - 1; }
+
+  // The k x k upper triangular factor R
+  Matrix<coeff_t> const &R() const { return R_; }
+
+  // The m x k factor Q with orthonormal columns
+  Matrix<coeff_t> Q() const { return apply_q(Identity<coeff_t>(ncols())); }
+
+  // Q C for a k x p matrix C, from the root of the tree down to the chunks
+  Matrix<coeff_t> apply_q(Matrix<coeff_t> const &C) const {
+    lila_size_t m = nrows();
+    lila_size_t k = ncols();
+    lila_size_t p = C.ncols();
+    assert(C.nrows() == k);
+
+    std::vector<Matrix<coeff_t>> cur(1, C);
+    for (lila_size_t l = tree_.size(); l-- > 0;) {
+      auto const &Q = tree_[l];
+      lila_size_t nodes = Q.size();
+      lila_size_t children = (l == 0) ? nchunks() : tree_[l - 1].size();
+      std::vector<Matrix<coeff_t>> next(children);
+      LILA_OMP(omp parallel for if (nodes > 1))
+      for (lila_size_t j = 0; j < nodes; ++j) {
+        if (Q[j].size() == 0) {
+          next[2 * j] = std::move(cur[j]);
+          continue;
+        }
+        next[2 * j] = Matrix<coeff_t>(k, p);
+        next[2 * j + 1] = Matrix<coeff_t>(k, p);
+        detail::gemm('N', 'N', k, p, k, coeff_t(1.), Q[j].data(), 2 * k,
+                     cur[j].data(), k, coeff_t(0.), next[2 * j].data(), k);
+        detail::gemm('N', 'N', k, p, k, coeff_t(1.), Q[j].data() + k, 2 * k,
+                     cur[j].data(), k, coeff_t(0.), next[2 * j + 1].data(), k);
+      }
+      cur = std::move(next);
+    }
+
+    Matrix<coeff_t> res(m, p);
+    lila_size_t n = nchunks();
+    LILA_OMP(omp parallel for if (n > 1))
+    for (lila_size_t i = 0; i < n; ++i)
+      detail::gemm('N', 'N', offsets_[i + 1] - offsets_[i], p, k, coeff_t(1.),
+                   leaves_.data() + offsets_[i], m, cur[i].data(), k,
+                   coeff_t(0.), res.data() + offsets_[i], m);
+    return res;
+  }
+
+  // Q^H B for an m x p matrix B, from the chunks up to the root of the tree
+  Matrix<coeff_t> apply_qh(Matrix<coeff_t> const &B) const {
+    lila_size_t m = nrows();
+    lila_size_t k = ncols();
+    lila_size_t p = B.ncols();
+    assert(B.nrows() == m);
+
+    lila_size_t n = nchunks();
+    std::vector<Matrix<coeff_t>> cur(n);
+    LILA_OMP(omp parallel for if (n > 1))
+    for (lila_size_t i = 0; i < n; ++i) {
+      cur[i] = Matrix<coeff_t>(k, p);
+      detail::gemm('C', 'N', k, p, offsets_[i + 1] - offsets_[i], coeff_t(1.),
+                   leaves_.data() + offsets_[i], m, B.data() + offsets_[i], m,
+                   coeff_t(0.), cur[i].data(), k);
+    }
+
+    for (auto const &Q : tree_) {
+      lila_size_t nodes = Q.size();
+      std::vector<Matrix<coeff_t>> next(nodes);
+      LILA_OMP(omp parallel for if (nodes > 1))
+      for (lila_size_t j = 0; j < nodes; ++j) {
+        if (Q[j].size() == 0) {
+          next[j] = std::move(cur[2 * j]);
+          continue;
+        }
+        next[j] = Matrix<coeff_t>(k, p);
+        detail::gemm('C', 'N', k, p, k, coeff_t(1.), Q[j].data(), 2 * k,
+                     cur[2 * j].data(), k, coeff_t(0.), next[j].data(), k);
+        detail::gemm('C', 'N', k, p, k, coeff_t(1.), Q[j].data() + k, 2 * k,
+                     cur[2 * j + 1].data(), k, coeff_t(1.), next[j].data(),
+                     k);
+      }
+      cur = std::move(next);
+    }
+    return std::move(cur[0]);
+  }
+
+private:
+  Matrix<coeff_t> leaves_;
+  std::vector<lila_size_t> offsets_;
+  std::vector<std::vector<Matrix<coeff_t>>> tree_;
+  Matrix<coeff_t> R_;
+};
+
+// CholeskyQR2 of a tall-skinny m x k matrix (m >= k), returns (Q, R). The
+// Gram matrix A^H A is accumulated from row chunks in parallel, and Q =
+// A R^-1 is formed chunk by chunk; a second pass restores the orthogonality
+// lost in the first. Faster than TSQR but needs A to be well conditioned
+// (roughly cond(A) < 1 / sqrt(eps)), otherwise the Cholesky decomposition
+// fails.
+template <class coeff_t>
+inline std::pair<Matrix<coeff_t>, Matrix<coeff_t>>
+CholeskyQR2(Matrix<coeff_t> A, lila_size_t chunk_rows = 0) {
+  lila_size_t m = A.nrows();
+  lila_size_t k = A.ncols();
+  assert(m >= k);
+  auto offsets = detail::tsqr_offsets(m, k, chunk_rows);
+  lila_size_t nchunks = offsets.size() - 1;
+
+  auto R = Identity<coeff_t>(k);
+  std::vector<Matrix<coeff_t>> G(nchunks);
+  for (int pass = 0; pass < 2; ++pass) {
+    LILA_OMP(omp parallel for if (nchunks > 1))
+    for (lila_size_t i = 0; i < nchunks; ++i) {
+      G[i] = Matrix<coeff_t>(k, k);
+      Gram(A({offsets[i], offsets[i + 1]}, {0, k}), MatrixView<coeff_t>(G[i]));
+    }
+    for (lila_size_t i = 1; i < nchunks; ++i)
+      for (lila_size_t j = 0; j < k * k; ++j)
+        G[0].data()[j] += G[i].data()[j];
+
+    auto Rp = Cholesky(G[0], 'U');
+    LILA_OMP(omp parallel for if (nchunks > 1))
+    for (lila_size_t i = 0; i < nchunks; ++i)
+      SolveTriInplace(MatrixView<coeff_t>(Rp),
+                      A({offsets[i], offsets[i + 1]}, {0, k}), coeff_t(1.), 'R',
+                      'U', 'N');
+    R = Mult(Rp, R);
+  }
+  return {A, R};
+}
+
+} // namespace lila
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <utility>
+#include <vector>
+
+#include <lila/blaslapack/blaslapack_types.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/vector.h>
+
+namespace lila::detail {
+
+// Owning copy of a right-hand side, so that solving in place never writes to
+// the storage of a view
+template <class coeff_t>
+inline Matrix<coeff_t> owning_copy(Matrix<coeff_t> const &B) {
+  return B;
+}
+template <class coeff_t>
+inline Matrix<coeff_t> owning_copy(MatrixView<coeff_t> const &B) {
+  return Matrix<coeff_t>(B);
+}
+template <class coeff_t>
+inline Vector<coeff_t> owning_copy(Vector<coeff_t> const &b) {
+  return b;
+}
+template <class coeff_t>
+inline Vector<coeff_t> owning_copy(VectorView<coeff_t> const &b) {
+  return Vector<coeff_t>(b);
+}
+
+// B = conj(B) on a view with contiguous columns
+template <class coeff_t> inline void conj_inplace(MatrixView<coeff_t> B) {
+  if constexpr (is_complex<coeff_t>()) {
+    assert(B.incm() == 1);
+    lila_size_t ld = B.ld() * B.incn();
+    for (lila_size_t j = 0; j < B.n(); ++j)
+      for (lila_size_t i = 0; i < B.m(); ++i)
+        B.data()[i + j * ld] = conj(B.data()[i + j * ld]);
+  }
+}
+
+// 1-norm of a Hermitian matrix of which only the uplo triangle is set
+template <class coeff_t>
+inline real_t<coeff_t> norm1_hermitian(Matrix<coeff_t> const &A, char uplo) {
+  lila_size_t n = A.nrows();
+  real_t<coeff_t> value = 0.;
+  for (lila_size_t j = 0; j < n; ++j) {
+    real_t<coeff_t> col_sum = 0.;
+    for (lila_size_t i = 0; i < n; ++i) {
+      bool stored = (uplo == 'U') ? (i <= j) : (i >= j);
+      col_sum += std::abs(stored ? A(i, j) : A(j, i));
+    }
+    value = std::max(value, col_sum);
+  }
+  return value;
+}
+
+// true if A equals its conjugate transpose exactly
+template <class coeff_t> inline bool is_hermitian(Matrix<coeff_t> const &A) {
+  if (A.nrows() != A.ncols())
+    return false;
+  for (lila_size_t j = 0; j < A.ncols(); ++j)
+    for (lila_size_t i = j; i < A.nrows(); ++i)
+      if (A(i, j) != conj(A(j, i)))
+        return false;
+  return true;
+}
+
+// Number of row interchanges in the pivots of getrf
+inline blas_size_t pivot_swaps(std::vector<blas_size_t> const &ipiv) {
+  blas_size_t swaps = 0;
+  blas_size_t n = ipiv.size();
+  for (blas_size_t i = 0; i < n; ++i)
+    swaps += (ipiv[i] != i + 1);
+  return swaps;
+}
+
+// log|det A| and det A / |det A| from the output of getrf
+template <class coeff_t>
+inline std::pair<real_t<coeff_t>, coeff_t>
+lu_log_det(Matrix<coeff_t> const &LU, std::vector<blas_size_t> const &ipiv) {
+  real_t<coeff_t> log_det = 0.;
+  coeff_t phase = (pivot_swaps(ipiv) & 1) ? -1. : 1.;
+  for (lila_size_t i = 0; i < LU.nrows(); ++i) {
+    real_t<coeff_t> abs = std::abs(LU(i, i));
+    log_det += std::log(abs);
+    phase *= (abs > 0.) ? LU(i, i) / abs : coeff_t(0.);
+  }
+  return {log_det, phase};
+}
+
+// log det A from the output of potrf
+template <class coeff_t>
+inline real_t<coeff_t> cholesky_log_det(Matrix<coeff_t> const &R) {
+  real_t<coeff_t> log_det = 0.;
+  for (lila_size_t i = 0; i < R.nrows(); ++i)
+    log_det += std::log(real(R(i, i)));
+  return 2 * log_det;
+}
+
+} // namespace lila::detail
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <algorithm>
 #include <utility>
+#include <vector>
 
+#include <lila/blaslapack/blaslapack.h>
 #include <lila/matrix.h>
 #include <lila/numeric/complex.h>
 #include <lila/vector.h>
@@ -21,25 +24,40 @@ inline Vector<real_t<coeff_t>> EigenSymInplace(Matrix<coeff_t> &A,
   blas_size_t n = A.nrows();
   blas_size_t lda = n;
 
-  // get optimal work size
+  // Divide and conquer (syevd / heevd), get optimal work sizes first
   Vector<real_t<coeff_t>> w(n);
   blas_size_t lwork = -1;
+  blas_size_t lrwork = -1;
+  blas_size_t liwork = -1;
   std::vector<coeff_t> work(1);
+  std::vector<real_t<coeff_t>> rwork(1);
+  std::vector<blas_size_t> iwork(1);
   blas_size_t info = 0;
 
-  blaslapack::syev(&jobz, &uplo, &n, LILA_BLAS_CAST(coeff_t, A.data()), &lda,
-                   LILA_BLAS_CAST(real_t<coeff_t>, w.data()),
-                   LILA_BLAS_CAST(coeff_t, work.data()), &lwork, &info);
+  auto run = [&]() {
+    if constexpr (is_complex<coeff_t>()) {
+      blaslapack::heevd(&jobz, &uplo, &n, LILA_BLAS_CAST(coeff_t, A.data()),
+                        &lda, w.data(), LILA_BLAS_CAST(coeff_t, work.data()),
+                        &lwork, rwork.data(), &lrwork, iwork.data(), &liwork,
+                        &info);
+    } else {
+      blaslapack::syevd(&jobz, &uplo, &n, LILA_BLAS_CAST(coeff_t, A.data()),
+                        &lda, w.data(), LILA_BLAS_CAST(coeff_t, work.data()),
+                        &lwork, iwork.data(), &liwork, &info);
+    }
+  };
 
+  run();
   assert(info == 0);
   lwork = static_cast<blas_size_t>(real(work[0]));
-  work.resize(lwork);
+  lrwork = static_cast<blas_size_t>(rwork[0]);
+  liwork = iwork[0];
+  work.resize(std::max(lwork, (blas_size_t)1));
+  rwork.resize(std::max(lrwork, (blas_size_t)1));
+  iwork.resize(std::max(liwork, (blas_size_t)1));
 
   // Run eigenvalue computation
-  blaslapack::syev(&jobz, &uplo, &n, LILA_BLAS_CAST(coeff_t, A.data()), &lda,
-                   LILA_BLAS_CAST(real_t<coeff_t>, w.data()),
-                   LILA_BLAS_CAST(coeff_t, work.data()), &lwork, &info);
-
+  run();
   assert(info == 0);
   return w;
 }
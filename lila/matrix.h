@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithm>
 #include <memory>
 #include <vector>
 
@@ -129,13 +130,28 @@ public:
   lila_size_t n() const { return n_; }
   lila_size_t nrows() const { return m_; }
   lila_size_t ncols() const { return n_; }
+
+  // Keeps the top left min(m, m_) x min(n, n_) block and pads with zeros.
+  // The columns are moved within the storage, which only reallocates when
+  // its capacity is exceeded.
   void resize(lila_size_t m, lila_size_t n) {
-    Matrix<coeff_t> copy = (*this);
-    storage_->resize(m * n, 0);
-    std::fill(storage_->begin(), storage_->end(), 0);
-    for (int j = 0; j < std::min(n, n_); ++j)
-      for (int i = 0; i < std::min(m, m_); ++i)
-        (*storage_)[i + j * m] = copy(i, j);
+    lila_size_t ncols = std::min(n, n_);
+    if (m <= m_) {
+      coeff_t *data = storage_->data();
+      for (lila_size_t j = 1; j < ncols; ++j)
+        std::copy(data + j * m_, data + j * m_ + m, data + j * m);
+      storage_->resize(m * ncols);
+      storage_->resize(m * n, 0);
+    } else {
+      storage_->resize(m * n, 0);
+      coeff_t *data = storage_->data();
+      for (lila_size_t j = ncols; j-- > 0;) {
+        if (j > 0)
+          std::copy_backward(data + j * m_, data + (j + 1) * m_,
+                             data + j * m + m_);
+        std::fill(data + j * m + m_, data + (j + 1) * m, coeff_t(0.));
+      }
+    }
     m_ = m;
     n_ = n;
   }
@@ -6,6 +6,7 @@
 #include <lila/detail/complex_detail.h>
 #include <lila/matrix.h>
 #include <lila/vector.h>
+#include <lila/views/real_imag_view.h>
 
 namespace lila {
 
@@ -34,36 +35,43 @@ inline std::complex<double> conj(std::complex<double> x) {
 
 template <class coeff_t>
 inline Matrix<real_t<coeff_t>> Real(Matrix<coeff_t> const &X) {
-  Matrix<real_t<coeff_t>> Y(X.nrows(), X.ncols());
-  for (lila_size_t j = 0; j < X.ncols(); ++j)
-    for (lila_size_t i = 0; i < X.nrows(); ++i)
-      Y(i, j) = lila::real(X(i, j));
-  return Y;
+  return X;
 }
 
 template <class coeff_t>
 inline Vector<real_t<coeff_t>> Real(Vector<coeff_t> const &X) {
-  Vector<real_t<coeff_t>> Y(X.n());
-  for (lila_size_t i = 0; i < X.n(); ++i)
-    Y(i) = lila::real(X(i));
-  return Y;
+  return X;
 }
 
 template <class coeff_t>
 inline Matrix<real_t<coeff_t>> Imag(Matrix<coeff_t> const &X) {
-  Matrix<real_t<coeff_t>> Y(X.nrows(), X.ncols());
-  for (lila_size_t j = 0; j < X.ncols(); ++j)
-    for (lila_size_t i = 0; i < X.nrows(); ++i)
-      Y(i, j) = lila::imag(X(i, j));
-  return Y;
+  return Matrix<real_t<coeff_t>>(X.nrows(), X.ncols());
 }
 
 template <class coeff_t>
 inline Vector<real_t<coeff_t>> Imag(Vector<coeff_t> const &X) {
-  Vector<real_t<coeff_t>> Y(X.n());
-  for (lila_size_t i = 0; i < X.n(); ++i)
-    Y(i) = lila::imag(X(i));
-  return Y;
+  return Vector<real_t<coeff_t>>(X.n());
+}
+
+// Complex versions copy from the strided part views (BLAS copy, inc=2)
+template <class real_type>
+inline Matrix<real_type> Real(Matrix<std::complex<real_type>> const &X) {
+  return Matrix<real_type>(RealView(X));
+}
+
+template <class real_type>
+inline Vector<real_type> Real(Vector<std::complex<real_type>> const &X) {
+  return Vector<real_type>(RealView(X));
+}
+
+template <class real_type>
+inline Matrix<real_type> Imag(Matrix<std::complex<real_type>> const &X) {
+  return Matrix<real_type>(ImagView(X));
+}
+
+template <class real_type>
+inline Vector<real_type> Imag(Vector<std::complex<real_type>> const &X) {
+  return Vector<real_type>(ImagView(X));
 }
 
 template <class coeff_t> Matrix<coeff_t> Conj(Matrix<coeff_t> const &X) {
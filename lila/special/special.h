@@ -6,6 +6,7 @@
 #include <lila/matrix.h>
 #include <lila/numeric/complex.h>
 #include <lila/vector.h>
+#include <lila/views/real_imag_view.h>
 
 namespace lila {
 
@@ -57,21 +58,37 @@ template <class coeff_t> inline Matrix<coeff_t> Identity(lila_size_t m) {
   return id;
 }
 
+namespace detail {
+
+// A = A + c I
+template <class coeff_t>
+inline void add_identity(coeff_t c, Matrix<coeff_t> &A) {
+  for (lila_size_t i = 0; i < std::min(A.nrows(), A.ncols()); ++i)
+    A(i, i) += c;
+}
+
+} // namespace detail
+
 template <class coeff_t>
 inline Vector<complex_t<coeff_t>> Complex(Vector<coeff_t> const &vec) {
-  auto complex_vec = Zeros<complex_t<coeff_t>>(vec.n());
-  for (lila_size_t j = 0; j < vec.n(); ++j)
-    complex_vec(j) = (complex_t<coeff_t>)vec(j);
-  return complex_vec;
+  if constexpr (is_complex<coeff_t>()) {
+    return vec;
+  } else {
+    auto complex_vec = Zeros<complex_t<coeff_t>>(vec.n());
+    Copy(VectorView<coeff_t>(vec), RealView(complex_vec));
+    return complex_vec;
+  }
 }
 
 template <class coeff_t>
 inline Matrix<complex_t<coeff_t>> Complex(Matrix<coeff_t> const &mat) {
-  auto complex_mat = Zeros<complex_t<coeff_t>>(mat.m(), mat.n());
-  for (lila_size_t i = 0; i < mat.m(); ++i)
-    for (lila_size_t j = 0; j < mat.n(); ++j)
-      complex_mat(i, j) = (complex_t<coeff_t>)mat(i, j);
-  return complex_mat;
+  if constexpr (is_complex<coeff_t>()) {
+    return mat;
+  } else {
+    auto complex_mat = Zeros<complex_t<coeff_t>>(mat.m(), mat.n());
+    Copy(MatrixView<coeff_t>(mat), RealView(complex_mat));
+    return complex_mat;
+  }
 }
 
 template <class coeff_t>
@@ -0,0 +1,209 @@
+#pragma once
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+
+#include <lila/arithmetic/scale.h>
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/split/split_complex.h>
+
+namespace lila {
+
+namespace detail {
+
+// Element-wise kernels on split storage. They only touch plain real arrays
+// and avoid std::complex arithmetic (and its NaN recovery branches), so the
+// loops auto-vectorize.
+template <class real_type>
+inline void split_axpy(lila_size_t size, std::complex<real_type> alpha,
+                       real_type const *xr, real_type const *xi, real_type *yr,
+                       real_type *yi) {
+  blas_size_t n = size;
+  blas_size_t inc = 1;
+  real_type ar = alpha.real();
+  real_type ai = alpha.imag();
+  real_type mai = -ai;
+
+  // yr += ar * xr - ai * xi,  yi += ar * xi + ai * xr
+  blaslapack::axpy(&n, &ar, LILA_BLAS_CONST_CAST(real_type, xr), &inc, yr,
+                   &inc);
+  blaslapack::axpy(&n, &ar, LILA_BLAS_CONST_CAST(real_type, xi), &inc, yi,
+                   &inc);
+  if (ai != 0) {
+    blaslapack::axpy(&n, &mai, LILA_BLAS_CONST_CAST(real_type, xi), &inc, yr,
+                     &inc);
+    blaslapack::axpy(&n, &ai, LILA_BLAS_CONST_CAST(real_type, xr), &inc, yi,
+                     &inc);
+  }
+}
+
+template <class real_type>
+inline void split_scale(lila_size_t size, std::complex<real_type> alpha,
+                        real_type *re, real_type *im) {
+  real_type ar = alpha.real();
+  real_type ai = alpha.imag();
+  if (ai == 0) {
+    blas_size_t n = size;
+    blas_size_t inc = 1;
+    blaslapack::scal(&n, &ar, re, &inc);
+    blaslapack::scal(&n, &ar, im, &inc);
+  } else {
+    for (lila_size_t i = 0; i < size; ++i) {
+      real_type r = re[i];
+      real_type s = im[i];
+      re[i] = ar * r - ai * s;
+      im[i] = ar * s + ai * r;
+    }
+  }
+}
+
+template <class real_type>
+inline void split_hadamard_mult(lila_size_t size, real_type const *xr,
+                                real_type const *xi, real_type const *yr,
+                                real_type const *yi, real_type *zr,
+                                real_type *zi) {
+  for (lila_size_t i = 0; i < size; ++i) {
+    real_type a = xr[i];
+    real_type b = xi[i];
+    real_type c = yr[i];
+    real_type d = yi[i];
+    zr[i] = a * c - b * d;
+    zi[i] = a * d + b * c;
+  }
+}
+
+template <class real_type>
+inline real_type split_norm(lila_size_t size, real_type const *re,
+                            real_type const *im) {
+  blas_size_t n = size;
+  blas_size_t inc = 1;
+  real_type nr =
+      blaslapack::nrm2(&n, LILA_BLAS_CONST_CAST(real_type, re), &inc);
+  real_type ni =
+      blaslapack::nrm2(&n, LILA_BLAS_CONST_CAST(real_type, im), &inc);
+  return std::hypot(nr, ni);
+}
+
+template <class real_type, class function_t>
+inline void split_map(lila_size_t size, real_type *re, real_type *im,
+                      function_t func) {
+  for (lila_size_t i = 0; i < size; ++i)
+    func(re[i], im[i]);
+}
+
+} // namespace detail
+
+///////////////////////////////////////////
+// SplitVector
+
+template <class coeff_t>
+inline void Add(SplitVector<coeff_t> const &v, SplitVector<coeff_t> &w,
+                coeff_t alpha = static_cast<coeff_t>(1.)) {
+  assert(v.n() == w.n());
+  detail::split_axpy(v.n(), alpha, v.real().data(), v.imag().data(),
+                     w.real().data(), w.imag().data());
+}
+
+template <class coeff_t>
+inline void Scale(coeff_t alpha, SplitVector<coeff_t> &v) {
+  detail::split_scale(v.n(), alpha, v.real().data(), v.imag().data());
+}
+
+template <class coeff_t>
+inline coeff_t Dot(SplitVector<coeff_t> const &v,
+                   SplitVector<coeff_t> const &w) {
+  assert(v.n() == w.n());
+  using real_type = real_t<coeff_t>;
+  blas_size_t n = v.n();
+  blas_size_t inc = 1;
+  auto dot = [&n, &inc](Vector<real_type> const &x,
+                        Vector<real_type> const &y) {
+    return blaslapack::dot(&n, LILA_BLAS_CONST_CAST(real_type, x.data()), &inc,
+                           LILA_BLAS_CONST_CAST(real_type, y.data()), &inc);
+  };
+
+  // conj(v) * w = (vr.wr + vi.wi) + i (vr.wi - vi.wr)
+  real_type re = dot(v.real(), w.real()) + dot(v.imag(), w.imag());
+  real_type im = dot(v.real(), w.imag()) - dot(v.imag(), w.real());
+  return {re, im};
+}
+
+template <class coeff_t>
+inline real_t<coeff_t> Norm(SplitVector<coeff_t> const &v) {
+  return detail::split_norm(v.n(), v.real().data(), v.imag().data());
+}
+
+template <class coeff_t>
+inline SplitVector<coeff_t> Conj(SplitVector<coeff_t> const &v) {
+  SplitVector<coeff_t> res(v.real(), v.imag());
+  Scale(static_cast<real_t<coeff_t>>(-1.), res.imag());
+  return res;
+}
+
+template <class coeff_t>
+inline void HadamardMult(SplitVector<coeff_t> const &v,
+                         SplitVector<coeff_t> const &w,
+                         SplitVector<coeff_t> &res) {
+  assert(v.n() == w.n());
+  if (res.n() != v.n())
+    res.resize(v.n());
+  detail::split_hadamard_mult(v.n(), v.real().data(), v.imag().data(),
+                              w.real().data(), w.imag().data(),
+                              res.real().data(), res.imag().data());
+}
+
+// func is called as func(real_part &, imag_part &) for every element
+template <class coeff_t, class function_t>
+inline void Map(SplitVector<coeff_t> &v, function_t func) {
+  detail::split_map(v.n(), v.real().data(), v.imag().data(), func);
+}
+
+///////////////////////////////////////////
+// SplitMatrix
+
+template <class coeff_t>
+inline void Add(SplitMatrix<coeff_t> const &A, SplitMatrix<coeff_t> &B,
+                coeff_t alpha = static_cast<coeff_t>(1.)) {
+  assert(A.m() == B.m());
+  assert(A.n() == B.n());
+  detail::split_axpy(A.size(), alpha, A.real().data(), A.imag().data(),
+                     B.real().data(), B.imag().data());
+}
+
+template <class coeff_t>
+inline void Scale(coeff_t alpha, SplitMatrix<coeff_t> &A) {
+  detail::split_scale(A.size(), alpha, A.real().data(), A.imag().data());
+}
+
+template <class coeff_t>
+inline real_t<coeff_t> Norm(SplitMatrix<coeff_t> const &A) {
+  return detail::split_norm(A.size(), A.real().data(), A.imag().data());
+}
+
+template <class coeff_t>
+inline SplitMatrix<coeff_t> Conj(SplitMatrix<coeff_t> const &A) {
+  SplitMatrix<coeff_t> res(A.real(), A.imag());
+  Scale(static_cast<real_t<coeff_t>>(-1.), res.imag());
+  return res;
+}
+
+template <class coeff_t>
+inline void HadamardMult(SplitMatrix<coeff_t> const &A,
+                         SplitMatrix<coeff_t> const &B,
+                         SplitMatrix<coeff_t> &C) {
+  assert(A.m() == B.m());
+  assert(A.n() == B.n());
+  if ((C.m() != A.m()) || (C.n() != A.n()))
+    C = SplitMatrix<coeff_t>(A.m(), A.n());
+  detail::split_hadamard_mult(A.size(), A.real().data(), A.imag().data(),
+                              B.real().data(), B.imag().data(),
+                              C.real().data(), C.imag().data());
+}
+
+template <class coeff_t, class function_t>
+inline void Map(SplitMatrix<coeff_t> &A, function_t func) {
+  detail::split_map(A.size(), A.real().data(), A.imag().data(), func);
+}
+
+} // namespace lila
@@ -0,0 +1,191 @@
+#pragma once
+
+#include <cassert>
+#include <complex>
+
+#include <lila/blaslapack/blaslapack.h>
+#include <lila/common.h>
+#include <lila/matrix.h>
+#include <lila/numeric/complex.h>
+#include <lila/vector.h>
+
+namespace lila {
+
+// Complex vector with split (structure of arrays) storage, i.e. the real and
+// imaginary parts are kept in two separate contiguous real vectors. This
+// layout lets element-wise complex kernels run on plain real arrays, which
+// the compiler can vectorize. Use Interleave/Split to convert to/from the
+// interleaved std::complex storage expected by BLAS/LAPACK.
+template <class coeff_t> class SplitVector {
+public:
+  static_assert(is_complex<coeff_t>(), "SplitVector needs a complex type");
+  using coeff_type = coeff_t;
+  using value_type = coeff_t;
+  using real_type = real_t<coeff_t>;
+
+  SplitVector() = default;
+  explicit SplitVector(lila_size_t size) : re_(size), im_(size) {}
+  SplitVector(Vector<real_type> const &re, Vector<real_type> const &im)
+      : re_(re), im_(im) {
+    assert(re.size() == im.size());
+  }
+
+  bool operator==(SplitVector const &other) const {
+    return (re_ == other.re_) && (im_ == other.im_);
+  }
+
+  coeff_t operator()(lila_size_t i) const { return {re_(i), im_(i)}; }
+  void set(lila_size_t i, coeff_t c) {
+    re_(i) = c.real();
+    im_(i) = c.imag();
+  }
+
+  lila_size_t size() const { return re_.size(); }
+  lila_size_t n() const { return re_.size(); }
+  void resize(lila_size_t size) {
+    re_.resize(size);
+    im_.resize(size);
+  }
+  void clear() {
+    re_.clear();
+    im_.clear();
+  }
+
+  Vector<real_type> &real() { return re_; }
+  Vector<real_type> const &real() const { return re_; }
+  Vector<real_type> &imag() { return im_; }
+  Vector<real_type> const &imag() const { return im_; }
+
+private:
+  Vector<real_type> re_;
+  Vector<real_type> im_;
+};
+
+// Complex matrix with split storage, column-major like Matrix
+template <class coeff_t> class SplitMatrix {
+public:
+  static_assert(is_complex<coeff_t>(), "SplitMatrix needs a complex type");
+  using coeff_type = coeff_t;
+  using value_type = coeff_t;
+  using real_type = real_t<coeff_t>;
+
+  SplitMatrix() = default;
+  SplitMatrix(lila_size_t m, lila_size_t n) : re_(m, n), im_(m, n) {}
+  SplitMatrix(Matrix<real_type> const &re, Matrix<real_type> const &im)
+      : re_(re), im_(im) {
+    assert((re.m() == im.m()) && (re.n() == im.n()));
+  }
+
+  bool operator==(SplitMatrix const &other) const {
+    return (re_ == other.re_) && (im_ == other.im_);
+  }
+
+  coeff_t operator()(lila_size_t i, lila_size_t j) const {
+    return {re_(i, j), im_(i, j)};
+  }
+  void set(lila_size_t i, lila_size_t j, coeff_t c) {
+    re_(i, j) = c.real();
+    im_(i, j) = c.imag();
+  }
+
+  lila_size_t size() const { return re_.size(); }
+  lila_size_t m() const { return re_.m(); }
+  lila_size_t n() const { return re_.n(); }
+  lila_size_t nrows() const { return re_.m(); }
+  lila_size_t ncols() const { return re_.n(); }
+  void resize(lila_size_t m, lila_size_t n) {
+    re_.resize(m, n);
+    im_.resize(m, n);
+  }
+  void clear() {
+    re_.clear();
+    im_.clear();
+  }
+
+  Matrix<real_type> &real() { return re_; }
+  Matrix<real_type> const &real() const { return re_; }
+  Matrix<real_type> &imag() { return im_; }
+  Matrix<real_type> const &imag() const { return im_; }
+
+private:
+  Matrix<real_type> re_;
+  Matrix<real_type> im_;
+};
+
+namespace detail {
+
+// Scatter/gather between split and interleaved storage using strided BLAS copy
+template <class real_type>
+inline void split_copy(lila_size_t size, std::complex<real_type> const *src,
+                       real_type *re, real_type *im) {
+  blas_size_t n = size;
+  blas_size_t inc2 = 2;
+  blas_size_t inc1 = 1;
+  auto src_real = reinterpret_cast<real_type const *>(src);
+  blaslapack::copy(&n, LILA_BLAS_CONST_CAST(real_type, src_real), &inc2,
+                   LILA_BLAS_CAST(real_type, re), &inc1);
+  blaslapack::copy(&n, LILA_BLAS_CONST_CAST(real_type, src_real + 1), &inc2,
+                   LILA_BLAS_CAST(real_type, im), &inc1);
+}
+
+template <class real_type>
+inline void interleave_copy(lila_size_t size, real_type const *re,
+                            real_type const *im,
+                            std::complex<real_type> *dst) {
+  blas_size_t n = size;
+  blas_size_t inc2 = 2;
+  blas_size_t inc1 = 1;
+  auto dst_real = reinterpret_cast<real_type *>(dst);
+  blaslapack::copy(&n, LILA_BLAS_CONST_CAST(real_type, re), &inc1,
+                   LILA_BLAS_CAST(real_type, dst_real), &inc2);
+  blaslapack::copy(&n, LILA_BLAS_CONST_CAST(real_type, im), &inc1,
+                   LILA_BLAS_CAST(real_type, dst_real + 1), &inc2);
+}
+
+} // namespace detail
+
+template <class coeff_t>
+inline SplitVector<coeff_t> Split(Vector<coeff_t> const &v) {
+  SplitVector<coeff_t> res(v.size());
+  detail::split_copy(v.size(), v.data(), res.real().data(), res.imag().data());
+  return res;
+}
+
+template <class coeff_t>
+inline SplitMatrix<coeff_t> Split(Matrix<coeff_t> const &A) {
+  SplitMatrix<coeff_t> res(A.m(), A.n());
+  detail::split_copy(A.size(), A.data(), res.real().data(), res.imag().data());
+  return res;
+}
+
+template <class coeff_t>
+inline void Interleave(SplitVector<coeff_t> const &v, Vector<coeff_t> &w) {
+  if (w.size() != v.size())
+    w.resize(v.size());
+  detail::interleave_copy(v.size(), v.real().data(), v.imag().data(),
+                          w.data());
+}
+
+template <class coeff_t>
+inline Vector<coeff_t> Interleave(SplitVector<coeff_t> const &v) {
+  Vector<coeff_t> res(v.size());
+  Interleave(v, res);
+  return res;
+}
+
+template <class coeff_t>
+inline void Interleave(SplitMatrix<coeff_t> const &A, Matrix<coeff_t> &B) {
+  if ((B.m() != A.m()) || (B.n() != A.n()))
+    B = Matrix<coeff_t>(A.m(), A.n());
+  detail::interleave_copy(A.size(), A.real().data(), A.imag().data(),
+                          B.data());
+}
+
+template <class coeff_t>
+inline Matrix<coeff_t> Interleave(SplitMatrix<coeff_t> const &A) {
+  Matrix<coeff_t> res(A.m(), A.n());
+  Interleave(A, res);
+  return res;
+}
+
+} // namespace lila
@@ -15,7 +15,7 @@ template <class coeff_t> class Matrix;
 template <class coeff_t> class MatrixView {
 public:
   using vector_type = std::vector<coeff_t>;
-  MatrixView() : storage_(std::make_shared<vector_type>()){};
+  MatrixView() : data_(), ld_(0), m_(0), n_(0), incm_(1), incn_(1){};
   ~MatrixView() = default;
   MatrixView(MatrixView const &) = default;
   MatrixView(MatrixView &&) = default;
@@ -34,40 +34,45 @@ public:
   }
 
   MatrixView(Matrix<coeff_t> const &A)
-      : storage_(A.storage_), ld_(A.m()), begin_(0), m_(A.m()), n_(A.n()),
-        incm_(1), incn_(1) {}
+      : data_(A.storage_, A.storage_->data()), ld_(A.m()), m_(A.m()),
+        n_(A.n()), incm_(1), incn_(1) {}
 
   MatrixView(Matrix<coeff_t> &A, Slice const &slice_row, Slice const &slice_col)
-      : storage_(A.storage_), ld_(A.m()) {
+      : ld_(A.m()) {
     assert(slice_row.step != 0);
     assert(slice_col.step != 0);
 
     auto [aslice_row, am] = adjusted_slice_length(slice_row, A.m());
     auto [aslice_col, an] = adjusted_slice_length(slice_col, A.n());
 
-    begin_ = aslice_row.begin + ld_ * aslice_col.begin;
+    lila_size_t begin = aslice_row.begin + ld_ * aslice_col.begin;
+    data_ = std::shared_ptr<coeff_t>(A.storage_, A.data() + begin);
     m_ = am;
     n_ = an;
     incm_ = (slice_row.step > 0) ? slice_row.step : -slice_row.step;
     incn_ = (slice_col.step > 0) ? slice_col.step : -slice_col.step;
   }
 
+  MatrixView(std::shared_ptr<coeff_t> const &data, lila_size_t m,
+             lila_size_t n, lila_size_t ld, lila_size_t incm, lila_size_t incn)
+      : data_(data), ld_(ld), m_(m), n_(n), incm_(incm), incn_(incn) {}
+
   lila_size_t m() const { return m_; }
   lila_size_t n() const { return n_; }
   lila_size_t size() const { return m_ * n_; }
   lila_size_t incm() const { return incm_; }
   lila_size_t incn() const { return incn_; }
   lila_size_t ld() const { return ld_; }
-  long use_count() const { return storage_.use_count(); }
+  long use_count() const { return data_.use_count(); }
 
-  std::shared_ptr<vector_type> storage() { return storage_; }
-  coeff_t *data() { return storage_->data() + begin_; }
-  const coeff_t *data() const { return storage_->data() + begin_; }
+  std::shared_ptr<coeff_t> storage() const { return data_; }
+  coeff_t *data() { return data_.get(); }
+  const coeff_t *data() const { return data_.get(); }
 
 private:
-  std::shared_ptr<std::vector<coeff_t>> storage_;
+  // aliases the owning storage, so the view keeps it alive
+  std::shared_ptr<coeff_t> data_;
   lila_size_t ld_;
-  lila_size_t begin_;
   lila_size_t m_, n_;
   lila_size_t incm_, incn_;
 };
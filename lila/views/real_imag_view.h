@@ -0,0 +1,94 @@
+#pragma once
+
+#include <complex>
+#include <memory>
+
+#include <lila/matrix.h>
+#include <lila/vector.h>
+#include <lila/views/matrix_view.h>
+#include <lila/views/vector_view.h>
+
+namespace lila {
+
+// Views on the real or imaginary part of a complex Vector/Matrix. A
+// std::complex<T> array is laid out as interleaved (re, im) pairs of T, so
+// the real part is a real view with doubled stride on the same storage and
+// the imaginary part is the same view shifted by one. No data is copied, and
+// modifying the view modifies the complex object.
+
+namespace detail {
+
+template <class real_type>
+inline std::shared_ptr<real_type>
+part_pointer(std::shared_ptr<std::complex<real_type>> const &data,
+             int offset) {
+  return std::shared_ptr<real_type>(
+      data, reinterpret_cast<real_type *>(data.get()) + offset);
+}
+
+template <class real_type>
+inline VectorView<real_type>
+part_view(VectorView<std::complex<real_type>> const &v, int offset) {
+  return VectorView<real_type>(detail::part_pointer(v.storage(), offset),
+                               v.n(), 2 * v.inc());
+}
+
+template <class real_type>
+inline MatrixView<real_type>
+part_view(MatrixView<std::complex<real_type>> const &A, int offset) {
+  return MatrixView<real_type>(detail::part_pointer(A.storage(), offset),
+                               A.m(), A.n(), 2 * A.ld(), 2 * A.incm(),
+                               A.incn());
+}
+
+} // namespace detail
+
+template <class real_type>
+inline VectorView<real_type>
+RealView(VectorView<std::complex<real_type>> const &v) {
+  return detail::part_view(v, 0);
+}
+
+template <class real_type>
+inline VectorView<real_type>
+ImagView(VectorView<std::complex<real_type>> const &v) {
+  return detail::part_view(v, 1);
+}
+
+template <class real_type>
+inline VectorView<real_type>
+RealView(Vector<std::complex<real_type>> const &v) {
+  return RealView(VectorView<std::complex<real_type>>(v));
+}
+
+template <class real_type>
+inline VectorView<real_type>
+ImagView(Vector<std::complex<real_type>> const &v) {
+  return ImagView(VectorView<std::complex<real_type>>(v));
+}
+
+template <class real_type>
+inline MatrixView<real_type>
+RealView(MatrixView<std::complex<real_type>> const &A) {
+  return detail::part_view(A, 0);
+}
+
+template <class real_type>
+inline MatrixView<real_type>
+ImagView(MatrixView<std::complex<real_type>> const &A) {
+  return detail::part_view(A, 1);
+}
+
+template <class real_type>
+inline MatrixView<real_type>
+RealView(Matrix<std::complex<real_type>> const &A) {
+  return RealView(MatrixView<std::complex<real_type>>(A));
+}
+
+template <class real_type>
+inline MatrixView<real_type>
+ImagView(Matrix<std::complex<real_type>> const &A) {
+  return ImagView(MatrixView<std::complex<real_type>>(A));
+}
+
+} // namespace lila
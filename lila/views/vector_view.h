@@ -11,7 +11,7 @@ template <class coeff_t> class VectorView {
 public:
   using vector_type = std::vector<coeff_t>;
 
-  VectorView() : storage_(std::make_shared<vector_type>()){};
+  VectorView() : data_(), n_(0), inc_(1){};
   ~VectorView() = default;
   VectorView(VectorView const &) = default;
   VectorView(VectorView &&) = default;
@@ -30,15 +30,15 @@ public:
   }
 
   VectorView(Vector<coeff_t> const &v)
-      : storage_(v.storage_), begin_(0), n_(v.size()), inc_(1) {}
+      : data_(v.storage_, v.storage_->data()), n_(v.size()), inc_(1) {}
 
-  VectorView(Vector<coeff_t> &v, Slice const &slice) : storage_(v.storage_) {
+  VectorView(Vector<coeff_t> &v, Slice const &slice) {
 
     assert(slice.step != 0);
     lila_size_t length = v.size();
     auto [aslice, alength] = adjusted_slice_length(slice, length);
 
-    begin_ = aslice.begin;
+    data_ = std::shared_ptr<coeff_t>(v.storage_, v.data() + aslice.begin);
     n_ = alength;
     inc_ = (slice.step > 0) ? slice.step : -slice.step;
 
@@ -56,20 +56,24 @@ public:
 
   VectorView(std::shared_ptr<vector_type> const &storage, lila_size_t begin,
              lila_size_t n, lila_size_t inc)
-      : storage_(storage), begin_(begin), n_(n), inc_(inc) {}
+      : data_(storage, storage->data() + begin), n_(n), inc_(inc) {}
+
+  VectorView(std::shared_ptr<coeff_t> const &data, lila_size_t n,
+             lila_size_t inc)
+      : data_(data), n_(n), inc_(inc) {}
 
   lila_size_t size() const { return n_; }
   lila_size_t n() const { return n_; }
   lila_size_t inc() const { return inc_; }
-  long use_count() const { return storage_.use_count(); }
+  long use_count() const { return data_.use_count(); }
 
-  std::shared_ptr<vector_type> storage() { return storage_; }
-  coeff_t *data() { return storage_->data() + begin_; }
-  const coeff_t *data() const { return storage_->data() + begin_; }
+  std::shared_ptr<coeff_t> storage() const { return data_; }
+  coeff_t *data() { return data_.get(); }
+  const coeff_t *data() const { return data_.get(); }
 
 private:
-  std::shared_ptr<vector_type> storage_;
-  lila_size_t begin_;
+  // aliases the owning storage, so the view keeps it alive
+  std::shared_ptr<coeff_t> data_;
   lila_size_t n_;
   lila_size_t inc_;
 };
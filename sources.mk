@@ -8,20 +8,38 @@ sources+= test/views/test_views.cpp
 sources+= test/special/test_special.cpp
 sources+= test/special/test_random.cpp
 
+sources+= test/split/test_split_complex.cpp
+
 sources+= test/algebra/test_mult.cpp
 sources+= test/algebra/test_matrixfunction.cpp
+sources+= test/algebra/test_spectral_decomposition.cpp
 sources+= test/algebra/test_expm.cpp
+sources+= test/algebra/test_expmv.cpp
+sources+= test/algebra/test_lanczos_propagator.cpp
+sources+= test/algebra/test_chebyshev.cpp
+sources+= test/algebra/test_kpm.cpp
+sources+= test/algebra/test_polynomial.cpp
+sources+= test/algebra/test_matrix_iterations.cpp
 
 sources+= test/arithmetic/test_dot.cpp
 sources+= test/arithmetic/test_copy.cpp
 sources+= test/arithmetic/test_add.cpp
 sources+= test/arithmetic/test_scale.cpp
 sources+= test/arithmetic/test_norm.cpp
+sources+= test/arithmetic/test_hadamard.cpp
 
 sources+= test/decomp/test_solve.cpp
 sources+= test/decomp/test_qr.cpp
 sources+= test/decomp/test_cholesky.cpp
 sources+= test/decomp/test_determinant.cpp
+sources+= test/decomp/test_lu.cpp
+sources+= test/decomp/test_ldlt.cpp
+sources+= test/decomp/test_low_rank_update.cpp
+sources+= test/decomp/test_pfaffian.cpp
+sources+= test/decomp/test_svd.cpp
+sources+= test/decomp/test_tsqr.cpp
+sources+= test/decomp/test_least_squares.cpp
+sources+= test/decomp/test_incremental_qr.cpp
 
 sources+= test/eigen/test_eigen.cpp
 sources+= test/eigen/test_eigen_sym_tridiag.cpp
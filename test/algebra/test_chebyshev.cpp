@@ -0,0 +1,69 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_chebyshev() {
+  using namespace lila;
+  using real_type = real_t<coeff_t>;
+  int n = 40;
+  int k = 3;
+  for (int seed : range<int>(3)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+
+    auto A = Random(n, n, fgen);
+    auto H = A;
+    Add(Herm(A), H);
+    auto v = Random(n, fgen);
+    auto V = Random(n, k, fgen);
+    auto apply = [&H](auto const &in, auto &out) { Mult(H, in, out); };
+
+    // Spectral bounds enclose the spectrum
+    auto eigs = EigenvaluesSym(H);
+    auto [emin, emax] = SpectralBounds<coeff_t>(apply, n);
+    REQUIRE(emin <= eigs(0));
+    REQUIRE(emax >= eigs(n - 1));
+
+    // A spectrum symmetric around zero (alpha = 0) is spanned after two
+    // steps, the bounds stay tight
+    Matrix<coeff_t> P = Zeros<coeff_t>(n, n);
+    for (int i = 0; i < n; ++i)
+      P(i, i) = (i % 2) ? 1. : -1.;
+    auto apply_p = [&P](auto const &in, auto &out) { Mult(P, in, out); };
+    auto [pmin, pmax] = SpectralBounds<coeff_t>(apply_p, n);
+    REQUIRE(pmin <= -1.);
+    REQUIRE(pmax >= 1.);
+    REQUIRE(pmax - pmin < 2.1);
+
+    // exp(-H) on a vector and on a block of vectors
+    auto f = [](real_type x) { return coeff_t(std::exp(-x)); };
+    auto E = H;
+    ExpSym(E, coeff_t(-1.));
+    real_type tol = std::sqrt(std::numeric_limits<real_type>::epsilon());
+    auto Ev = Mult(E, v);
+    auto EV = Mult(E, V);
+    auto w = ChebyshevFunction(apply, f, v, emin, emax, 80);
+    REQUIRE(Norm(w - Ev) < tol * Norm(Ev));
+    auto W = ChebyshevFunction(apply, f, V, emin, emax, 80);
+    Add(EV, W, coeff_t(-1.));
+    REQUIRE(Norm(W) < tol * Norm(EV));
+
+    // Kernel damping still approximates smooth functions, factors decay
+    auto wj = ChebyshevFunction(apply, f, v, emin, emax, 200,
+                                ChebyshevKernel::Jackson);
+    REQUIRE(Norm(wj - Ev) < 1e-1 * Norm(Ev));
+    auto g = ChebyshevKernelFactors<real_type>(10, ChebyshevKernel::Lorentz);
+    REQUIRE(close(g[0], (real_type)1.));
+    for (int i = 1; i < 10; ++i)
+      REQUIRE(g[i] < g[i - 1]);
+  }
+}
+
+TEST_CASE("chebyshev", "[functions]") {
+  lila::Log("Test chebyshev");
+
+  test_chebyshev<float>();
+  test_chebyshev<double>();
+  test_chebyshev<std::complex<float>>();
+  test_chebyshev<std::complex<double>>();
+}
@@ -43,7 +43,23 @@ void test_expm()
     REQUIRE(close(Aexp2, Aexp));
 
     // Pade from EXPOKIT is actually really good in timing!!
-    
+
+    // Small to large norms select different Pade degrees and squarings
+    for (double scale : {1e-4, 1e-2, 0.1, 0.3, 1.5, 4.}) {
+      auto As = A;
+      Scale(coeff_t(scale), As);
+      if (scale < 1.) {
+        auto E = ExpM(As);
+        auto Einv = ExpM(As, coeff_t(-1.));
+        REQUIRE(close(Mult(E, Einv), Identity<coeff_t>(n)));
+      }
+
+      auto As1 = A1;
+      Scale(coeff_t(scale), As1);
+      auto Es = As1;
+      ExpSym(Es);
+      REQUIRE(close(ExpM(As1), Es));
+    }
   }
 }
 
@@ -0,0 +1,50 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_expmv() {
+  using namespace lila;
+  int n = 20;
+  int k = 3;
+  for (int seed : range<int>(5)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+
+    auto A = Random(n, n, fgen);
+    auto v = Random(n, fgen);
+    auto V = Random(n, k, fgen);
+
+    for (double t : {0., 1e-3, 0.1, 1., 3.}) {
+      auto E = ExpM(A, coeff_t(t));
+
+      // Dense matrix, vector and block of vectors
+      auto w = ExpMV(A, coeff_t(t), v);
+      REQUIRE(close(w, Mult(E, v)));
+      auto W = ExpMV(A, coeff_t(t), V);
+      REQUIRE(close(W, Mult(E, V)));
+
+      // Matrix-free
+      auto apply = [&A](Vector<coeff_t> const &x, Vector<coeff_t> &y) {
+        Mult(A, x, y);
+      };
+      auto w2 = ExpMV(apply, Norm1(A), coeff_t(t), v);
+      REQUIRE(close(w2, Mult(E, v)));
+    }
+
+    // Several times
+    std::vector<coeff_t> times = {0.1, 0.5, 0.5, 2.};
+    auto ws = ExpMV(A, times, v);
+    REQUIRE(ws.size() == times.size());
+    for (int i = 0; i < (int)times.size(); ++i)
+      REQUIRE(close(ws[i], Mult(ExpM(A, times[i]), v)));
+  }
+}
+
+TEST_CASE("expmv", "[functions]") {
+  lila::Log("Test expmv");
+
+  test_expmv<float>();
+  test_expmv<double>();
+  test_expmv<std::complex<float>>();
+  test_expmv<std::complex<double>>();
+}
@@ -0,0 +1,82 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_kpm() {
+  using namespace lila;
+  using real_type = real_t<coeff_t>;
+  int n = 50;
+  int order = 30;
+  for (int seed : range<int>(3)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+
+    auto A = Random(n, n, fgen);
+    auto H = A;
+    Add(Herm(A), H);
+    auto alpha = Random(n, fgen);
+    auto beta = Random(n, fgen);
+    auto apply = [&H](Vector<coeff_t> const &in, Vector<coeff_t> &out) {
+      Mult(H, in, out);
+    };
+    auto [emin, emax] = SpectralBounds<coeff_t>(apply, n);
+
+    // Exact moments from the eigendecomposition
+    auto [eigs, Q] = EigenSym(H);
+    Vector<coeff_t> qa, qb;
+    Mult(Q, alpha, qa, coeff_t(1.), coeff_t(0.), 'C');
+    Mult(Q, beta, qb, coeff_t(1.), coeff_t(0.), 'C');
+    real_type center = (emax + emin) / 2;
+    real_type halfwidth = (emax - emin) / 2;
+    std::vector<real_type> mu_aa(order, 0.);
+    std::vector<coeff_t> mu_ba(order, 0.);
+    std::vector<real_type> mu_tr(order, 0.);
+    for (int i = 0; i < n; ++i) {
+      real_type theta = std::acos((eigs(i) - center) / halfwidth);
+      for (int k = 0; k < order; ++k) {
+        real_type tk = std::cos(k * theta);
+        mu_aa[k] += std::norm(qa(i)) * tk;
+        mu_ba[k] += lila::conj(qb(i)) * qa(i) * tk;
+        mu_tr[k] += tk / n;
+      }
+    }
+
+    real_type tol = std::sqrt(std::numeric_limits<real_type>::epsilon());
+    auto mu = KPMMoments(apply, alpha, emin, emax, order);
+    auto mu2 = KPMMoments(apply, alpha, beta, emin, emax, order);
+    REQUIRE((int)mu.size() == order);
+    for (int k = 0; k < order; ++k) {
+      REQUIRE(std::abs(mu[k] - mu_aa[k]) < tol * mu_aa[0]);
+      REQUIRE(std::abs(mu2[k] - mu_ba[k]) < tol * mu_aa[0]);
+    }
+
+    // Stochastic trace and density of states
+    auto mus = KPMMomentsStochastic<coeff_t>(apply, n, emin, emax, order, 20);
+    REQUIRE(close(mus[0], (real_type)1.));
+    for (int k = 1; k < order; ++k)
+      REQUIRE(std::abs(mus[k] - mu_tr[k]) < 0.2);
+
+    int npoints = 200;
+    auto [energies, dos] = KPMDensity(mus, emin, emax, npoints);
+    real_type integral = 0.;
+    for (int j = 0; j < npoints; ++j) {
+      REQUIRE(dos[j] > -1e-3);
+      real_type x = (energies[j] - center) / halfwidth;
+      integral += dos[j] * M_PI * halfwidth * std::sqrt(1 - x * x) / npoints;
+    }
+    REQUIRE(std::abs(integral - 1.) < 1e-3);
+
+    auto dos2 = KPMDensity(mus, emin, emax, energies);
+    for (int j = 0; j < npoints; ++j)
+      REQUIRE(std::abs(dos2[j] - dos[j]) < 1e-3);
+  }
+}
+
+TEST_CASE("kpm", "[functions]") {
+  lila::Log("Test kpm");
+
+  test_kpm<float>();
+  test_kpm<double>();
+  test_kpm<std::complex<float>>();
+  test_kpm<std::complex<double>>();
+}
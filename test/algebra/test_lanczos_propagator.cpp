@@ -0,0 +1,82 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t>
+void test_lanczos_propagator(coeff_t z, lila::real_t<coeff_t> t) {
+  using namespace lila;
+  int n = 100;
+  for (int seed : range<int>(3)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+
+    auto A = Random(n, n, fgen);
+    auto H = A;
+    Add(Herm(A), H);
+    auto psi0 = Random(n, fgen);
+    Normalize(psi0);
+    auto apply = [](Matrix<coeff_t> const &H, Vector<coeff_t> const &in,
+                    Vector<coeff_t> &out) { Mult(H, in, out); };
+
+    auto E = H;
+    ExpSym(E, z * t);
+    auto exact = Mult(E, psi0);
+
+    // Adaptive evolution, workspace reused for two consecutive calls
+    LanczosPropagator<coeff_t> prop(n, 20);
+    auto psi = psi0;
+    prop.Evolve(H, apply, psi, z, t / 2);
+    prop.Evolve(H, apply, psi, z, t / 2);
+    REQUIRE(prop.nsteps() > 1);
+    REQUIRE(close(psi, exact));
+
+    // Single step in a Krylov space spanning the whole space is exact
+    LanczosPropagator<coeff_t> full(n, n);
+    psi = psi0;
+    auto err = full.Step(H, apply, psi, z, real_t<coeff_t>(0.01));
+    auto E2 = H;
+    ExpSym(E2, z * real_t<coeff_t>(0.01));
+    REQUIRE(close(psi, Mult(E2, psi0)));
+    REQUIRE(err < 1e-3);
+  }
+}
+
+// A small perturbation of a large diagonal, beta << alpha is no breakdown
+template <class coeff_t> void test_lanczos_propagator_shifted() {
+  using namespace lila;
+  int n = 50;
+  uniform_dist_t<coeff_t> fdist(-1., 1.);
+  uniform_gen_t<coeff_t> fgen(fdist, 0);
+  auto A = Random(n, n, fgen);
+  auto H = A;
+  Add(Herm(A), H);
+  Scale(coeff_t(1e-9), H);
+  for (int i = 0; i < n; ++i)
+    H(i, i) += 1.;
+  auto psi0 = Random(n, fgen);
+  Normalize(psi0);
+  auto apply = [](Matrix<coeff_t> const &H, Vector<coeff_t> const &in,
+                  Vector<coeff_t> &out) { Mult(H, in, out); };
+
+  coeff_t z(0., -1.);
+  real_t<coeff_t> t = 1e6;
+  auto E = H;
+  ExpSym(E, z * t);
+  LanczosPropagator<coeff_t> prop(n, 20);
+  auto psi = psi0;
+  prop.Evolve(H, apply, psi, z, t);
+  REQUIRE(close(psi, Mult(E, psi0), 1e-6));
+}
+
+TEST_CASE("lanczos_propagator", "[functions]") {
+  lila::Log("Test lanczos_propagator");
+
+  // imaginary time
+  test_lanczos_propagator<double>(-1., 0.5);
+  test_lanczos_propagator<std::complex<double>>(-1., 0.5);
+
+  // real time
+  test_lanczos_propagator<std::complex<float>>({0., -1.}, 1.);
+  test_lanczos_propagator<std::complex<double>>({0., -1.}, 1.);
+  test_lanczos_propagator_shifted<std::complex<double>>();
+}
@@ -0,0 +1,81 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_matrix_iterations() {
+  using namespace lila;
+  using real_type = real_t<coeff_t>;
+  int n = 20;
+  int m = 30;
+  for (int seed : range<int>(3)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+    auto B = Random(n, n, fgen);
+    auto Id = Identity<coeff_t>(n);
+
+    // Sign of a Hermitian matrix
+    auto H = B;
+    Add(Herm(B), H);
+    IterationInfo<real_type> info;
+    auto S = SignSym(H, detail::iteration_tol<coeff_t>(), 100, &info);
+    REQUIRE(info.converged);
+    REQUIRE(!info.fallback);
+    SpectralDecomposition<coeff_t> sd(H);
+    auto S2 =
+        sd.apply([](real_type x) { return real_type((x > 0.) - (x < 0.)); });
+    REQUIRE(close(S, S2));
+    REQUIRE(close(Mult(S, S), Id));
+
+    // Square root and inverse square root of a positive definite matrix
+    auto A = Mult(B, Herm(B));
+    detail::add_identity(coeff_t(0.1), A);
+    for (auto method : {SqrtMethod::NewtonSchulz, SqrtMethod::DenmanBeavers}) {
+      auto YZ = SqrtInvSqrtSym(A, method, detail::iteration_tol<coeff_t>(),
+                               100, &info);
+      REQUIRE(info.converged);
+      REQUIRE(!info.fallback);
+      REQUIRE(close(Mult(YZ.first, YZ.first), A));
+      REQUIRE(close(Mult(YZ.first, YZ.second), Id));
+      REQUIRE(close(SqrtSym(A, method), YZ.first));
+      REQUIRE(close(InvSqrtSym(A, method), YZ.second));
+    }
+
+    // Too few iterations fall back to the eigendecomposition
+    auto Y = SqrtSym(A, SqrtMethod::NewtonSchulz,
+                     detail::iteration_tol<coeff_t>(), 2, &info);
+    REQUIRE(info.fallback);
+    REQUIRE(close(Mult(Y, Y), A));
+
+    // Polar decomposition of square and tall matrices
+    for (int rows : {n, m}) {
+      auto C = Random(rows, n, fgen);
+      auto UH = Polar(C, detail::iteration_tol<coeff_t>(), 100, &info);
+      REQUIRE(info.converged);
+      REQUIRE(!info.fallback);
+      auto U = UH.first;
+      auto P = UH.second;
+      REQUIRE(close(Mult(U, P), C));
+      REQUIRE(close(Mult(Herm(U), U), Id));
+      REQUIRE(close(P, Herm(P)));
+      for (auto e : EigenvaluesSym(P))
+        REQUIRE(e > 0.);
+    }
+
+    // Singular matrices fall back to the eigendecomposition
+    auto D = Random(n, n, fgen);
+    for (int i = 0; i < n; ++i)
+      D(i, 0) = 0.;
+    auto UH = Polar(D, detail::iteration_tol<coeff_t>(), 100, &info);
+    REQUIRE(info.fallback);
+    REQUIRE(close(Mult(UH.first, UH.second), D));
+  }
+}
+
+TEST_CASE("matrix_iterations", "[functions]") {
+  lila::Log("Test matrix_iterations");
+
+  test_matrix_iterations<float>();
+  test_matrix_iterations<double>();
+  test_matrix_iterations<std::complex<float>>();
+  test_matrix_iterations<std::complex<double>>();
+}
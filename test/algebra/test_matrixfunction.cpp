@@ -29,6 +29,17 @@ void test_matrixfunction()
     auto v2 = EigenvaluesSym(Aexp);
     for (auto e : v2)
       REQUIRE(e >= 0);
+
+    // Indefinite (gemm) and sign-definite (syrk / herk) reconstruction
+    auto Aid = A1;
+    FunctionSym(Aid, [](coeff_t &) {});
+    REQUIRE(close(Aid, A1));
+    auto Asq = A1;
+    FunctionSym(Asq, [](coeff_t &x) { x = x * x; });
+    REQUIRE(close(Asq, Mult(A1, A1)));
+    auto Amsq = A1;
+    FunctionSym(Amsq, [](coeff_t &x) { x = -x * x; });
+    REQUIRE(close(Amsq, (coeff_t)(-1.) * Mult(A1, A1)));
     
   }
 }
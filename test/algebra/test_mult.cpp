@@ -76,6 +76,87 @@ template <class coeff_t> void test_mult() {
   B(1, 1) = 7;
   Kron(A, B, C);
   // Print(C);
+  for (int r = 0; r < 2; ++r)
+    for (int s = 0; s < 3; ++s)
+      for (int v = 0; v < 2; ++v)
+        for (int w = 0; w < 2; ++w)
+          REQUIRE(C(2 * r + v, 2 * s + w) == A(r, s) * B(v, w));
+
+  // Implicit Kronecker product application
+  auto K1 = lila::Random<coeff_t>(3, 4);
+  auto K2 = lila::Random<coeff_t>(5, 2);
+  auto K3 = lila::Random<coeff_t>(2, 3);
+  auto x = lila::Random<coeff_t>(4 * 2);
+  auto y = lila::KronMult(K1, K2, x);
+  REQUIRE(lila::close(y, lila::Mult(lila::Kron(K1, K2), x)));
+
+  auto x3 = lila::Random<coeff_t>(4 * 2 * 3);
+  auto y3 = lila::KronMult({K1, K2, K3}, x3);
+  auto K123 = lila::Kron(lila::Kron(K1, K2), K3);
+  REQUIRE(lila::close(y3, lila::Mult(K123, x3)));
+}
+
+template <class coeff_t> void test_mult_structured() {
+  using namespace lila;
+  int n = 12;
+  int k = 5;
+  for (int seed : range<int>(3)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+    auto B = Random(n, n, fgen);
+    auto X = Random(n, k, fgen);
+    auto Xr = Random(k, n, fgen);
+    auto x = Random(n, fgen);
+
+    // Hermitian products only reference the upper triangle
+    auto H = B;
+    Add(Herm(B), H);
+    auto Hu = H;
+    for (int j = 0; j < n; ++j)
+      for (int i = j + 1; i < n; ++i)
+        Hu(i, j) = 42.;
+    REQUIRE(close(MultSym(Hu, X), Mult(H, X)));
+    REQUIRE(close(MultSym(Hu, Xr, 'R'), Mult(Xr, H)));
+    REQUIRE(close(MultSym(Hu, x), Mult(H, x)));
+    auto C = Random(n, k, fgen);
+    auto C2 = C;
+    MultSym(Hu, X, C, coeff_t(2.), coeff_t(-1.));
+    Mult(H, X, C2, coeff_t(2.), coeff_t(-1.));
+    REQUIRE(close(C, C2));
+
+    // Gram matrices
+    REQUIRE(close(Gram(X), Mult(Herm(X), X)));
+    REQUIRE(close(Gram(X, 'N'), Mult(X, Herm(X))));
+
+    // Triangular products
+    auto U = B;
+    for (int j = 0; j < n; ++j)
+      for (int i = j + 1; i < n; ++i)
+        U(i, j) = 0.;
+    auto L = Herm(U);
+    REQUIRE(close(MultTri(B, X), Mult(U, X)));
+    REQUIRE(close(MultTri(B, Xr, 'R'), Mult(Xr, U)));
+    REQUIRE(close(MultTri(B, X, 'L', 'U', 'C'), Mult(L, X)));
+    REQUIRE(close(MultTri(L, X, 'L', 'L'), Mult(L, X)));
+    REQUIRE(close(MultTri(B, x), Mult(U, x)));
+
+    // Views on blocks of larger matrices
+    int m = n / 2;
+    Matrix<coeff_t> Hm = H({0, m}, {0, m});
+    Matrix<coeff_t> Xm = X({0, m}, {0, k});
+    auto D = Zeros<coeff_t>(n, k);
+    MultSym(Hu({0, m}, {0, m}), X({0, m}, {0, k}), D({0, m}, {0, k}));
+    REQUIRE(close(Matrix<coeff_t>(D({0, m}, {0, k})), Mult(Hm, Xm)));
+    REQUIRE(
+        close(Matrix<coeff_t>(D({m, n}, {0, k})), Zeros<coeff_t>(n - m, k)));
+    auto G = Zeros<coeff_t>(k + 1, k + 1);
+    Gram(X({0, m}, {0, k}), G({1, k + 1}, {1, k + 1}));
+    REQUIRE(close(Matrix<coeff_t>(G({1, k + 1}, {1, k + 1})),
+                  Mult(Herm(Xm), Xm)));
+    MultTriInplace(B({0, m}, {0, m}), X({0, m}, {0, k}));
+    Matrix<coeff_t> Um = U({0, m}, {0, m});
+    REQUIRE(close(Matrix<coeff_t>(X({0, m}, {0, k})), Mult(Um, Xm)));
+  }
 }
 
 TEST_CASE("mult", "[algebra]") {
@@ -85,4 +166,9 @@ TEST_CASE("mult", "[algebra]") {
   test_mult<double>();
   test_mult<std::complex<float>>();
   test_mult<std::complex<double>>();
+
+  test_mult_structured<float>();
+  test_mult_structured<double>();
+  test_mult_structured<std::complex<float>>();
+  test_mult_structured<std::complex<double>>();
 }
@@ -0,0 +1,42 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_polynomial() {
+  using namespace lila;
+  int n = 15;
+  int k = 4;
+  for (int seed : range<int>(3)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+
+    auto A = Random(n, n, fgen);
+    Scale(coeff_t(1. / n), A);
+    auto v = Random(n, fgen);
+    auto V = Random(n, k, fgen);
+
+    for (int deg : {0, 1, 2, 3, 5, 8, 12, 17}) {
+      auto coeffs = Random(deg + 1, fgen).vector();
+
+      // Naive evaluation sum_k c_k A^k
+      auto P = Zeros<coeff_t>(n, n);
+      auto Ak = Identity<coeff_t>(n);
+      for (int d = 0; d <= deg; ++d) {
+        Add(Ak, P, coeffs[d]);
+        Ak = Mult(Ak, A);
+      }
+
+      auto P2 = PolyEval(A, coeffs);
+      REQUIRE(close(P, P2));
+      REQUIRE(close(PolyEval(A, coeffs, V), Mult(P, V)));
+      REQUIRE(close(PolyEval(A, coeffs, v), Mult(P, v)));
+    }
+  }
+}
+
+TEST_CASE("polynomial", "[algebra]") {
+  test_polynomial<float>();
+  test_polynomial<double>();
+  test_polynomial<std::complex<float>>();
+  test_polynomial<std::complex<double>>();
+}
@@ -0,0 +1,63 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_spectral_decomposition() {
+  using namespace lila;
+  using real_type = real_t<coeff_t>;
+  int n = 12;
+  int k = 3;
+  for (int seed : range<int>(5)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+
+    auto A = Random(n, n, fgen);
+    auto H = A;
+    Add(Herm(A), H);
+    auto v = Random(n, fgen);
+    auto V = Random(n, k, fgen);
+
+    SpectralDecomposition<coeff_t> spec(H);
+    REQUIRE(spec.n() == n);
+    REQUIRE(close(spec.eigenvalues(), EigenvaluesSym(H)));
+
+    // f(A) with sign-definite and indefinite functions
+    REQUIRE(close(spec.apply([](real_type x) { return x; }), H));
+    REQUIRE(close(spec.apply([](real_type x) { return x * x; }), Mult(H, H)));
+
+    std::vector<coeff_t> ts = {0., 0.1, -0.3, 0.7};
+    auto exps = spec.exp(ts);
+    auto expvs = spec.exp(ts, v);
+    auto expVs = spec.exp(ts, V);
+    for (int i = 0; i < (int)ts.size(); ++i) {
+      auto E = H;
+      ExpSym(E, ts[i]);
+      REQUIRE(close(exps[i], E));
+      REQUIRE(close(spec.exp(ts[i]), E));
+      REQUIRE(close(expvs[i], Mult(E, v)));
+      REQUIRE(close(spec.exp(ts[i], v), Mult(E, v)));
+      REQUIRE(close(expVs[i], Mult(E, V)));
+    }
+
+    // Generic parametrized functions
+    std::vector<real_type> shifts = {0.5, 2.};
+    auto res = spec.apply(
+        [](real_type s, real_type x) { return coeff_t(1. / (x * x + s)); },
+        shifts, V);
+    for (int i = 0; i < (int)shifts.size(); ++i) {
+      auto M = Mult(H, H);
+      for (int j = 0; j < n; ++j)
+        M(j, j) += shifts[i];
+      REQUIRE(close(Mult(M, res[i]), V));
+    }
+  }
+}
+
+TEST_CASE("spectral_decomposition", "[functions]") {
+  lila::Log("Test spectral_decomposition");
+
+  test_spectral_decomposition<float>();
+  test_spectral_decomposition<double>();
+  test_spectral_decomposition<std::complex<float>>();
+  test_spectral_decomposition<std::complex<double>>();
+}
@@ -0,0 +1,86 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_hadamard() {
+  using namespace lila;
+  using real_type = real_t<coeff_t>;
+  int m = 7;
+  int n = 11;
+
+  // Vector
+  auto x = Random<coeff_t>(n);
+  auto y = Random<coeff_t>(n);
+  auto z = Random<coeff_t>(n);
+  auto z0 = z;
+  auto prod = HadamardMult(x, y);
+  Vector<coeff_t> quot(n);
+  HadamardDiv(x, y, quot);
+  HadamardFma(x, y, z);
+  for (int i = 0; i < n; ++i) {
+    REQUIRE(close(prod(i), x(i) * y(i)));
+    REQUIRE(close(quot(i), x(i) / y(i)));
+    REQUIRE(close(z(i), x(i) * y(i) + z0(i)));
+  }
+
+  // VectorView (steps) mixed with Vector, output aliasing the input
+  auto x2 = x;
+  auto half = Random<coeff_t>((n + 1) / 2);
+  HadamardMult(x2({0, n, 2}), half, x2({0, n, 2}));
+  for (int i = 0; i < n; ++i)
+    REQUIRE(close(x2(i), (i % 2 == 0) ? x(i) * half(i / 2) : x(i)));
+
+  // Complex times real diagonal
+  auto d = Random<real_type>(n);
+  auto v = x;
+  HadamardMult(d, v, v);
+  for (int i = 0; i < n; ++i)
+    REQUIRE(close(v(i), x(i) * d(i)));
+
+  // Matrix
+  auto A = Random<coeff_t>(m, n);
+  auto B = Random<coeff_t>(m, n);
+  auto C = Random<coeff_t>(m, n);
+  auto C0 = C;
+  auto AB = HadamardMult(A, B);
+  HadamardFma(A, B, C);
+  for (int i = 0; i < m; ++i)
+    for (int j = 0; j < n; ++j) {
+      REQUIRE(close(AB(i, j), A(i, j) * B(i, j)));
+      REQUIRE(close(C(i, j), A(i, j) * B(i, j) + C0(i, j)));
+    }
+
+  // MatrixView
+  auto D = C0;
+  HadamardDiv(A({1, 5}, {2, 9}), B({1, 5}, {2, 9}), D({0, 4}, {0, 7}));
+  for (int i = 0; i < 4; ++i)
+    for (int j = 0; j < 7; ++j)
+      REQUIRE(close(D(i, j), A(i + 1, j + 2) / B(i + 1, j + 2)));
+
+  // Diagonal scaling
+  auto dm = Random<real_type>(m);
+  auto dn = Random<real_type>(n);
+  auto E = A;
+  ScaleRows(dm, E);
+  ScaleCols(dn, E);
+  for (int i = 0; i < m; ++i)
+    for (int j = 0; j < n; ++j)
+      REQUIRE(close(E(i, j), dm(i) * A(i, j) * dn(j)));
+
+  E = A;
+  ScaleCols(dn({0, 4}), E({0, m, 2}, {3, 7}));
+  for (int i = 0; i < m; ++i)
+    for (int j = 0; j < n; ++j) {
+      bool inside = (i % 2 == 0) && (3 <= j) && (j < 7);
+      REQUIRE(close(E(i, j), inside ? A(i, j) * dn(j - 3) : A(i, j)));
+    }
+}
+
+TEST_CASE("hadamard", "[arithmetic]") {
+  lila::Log("Test hadamard");
+
+  test_hadamard<float>();
+  test_hadamard<double>();
+  test_hadamard<std::complex<float>>();
+  test_hadamard<std::complex<double>>();
+}
@@ -36,9 +36,111 @@ void test_cholesky()
       // LilaPrint(prodl);
       REQUIRE(close(prodl, A)); 
 
+      // Test reusable factorization on a well-conditioned matrix
+      for (int i=0; i<n; ++i)
+	A(i,i) += (coeff_t)n;
+      auto B = Random<coeff_t>(n, 3);
+      auto b = Random<coeff_t>(n);
+      auto Id = Identity<coeff_t>(n);
+      for (char uplo : {'U', 'L'}) {
+        CholeskyFactor<coeff_t> chol(A, uplo);
+        REQUIRE(chol.positive_definite());
+        REQUIRE(close(Mult(A, chol.solve(B)), B));
+        REQUIRE(close(Mult(A, chol.solve(b)), b));
+        REQUIRE(close(Mult(Transpose(A), chol.solve_transposed(B)), B));
+
+        // views are copied, not overwritten
+        auto B1 = B;
+        auto BV = B1({0, n}, {1, 3});
+        REQUIRE(close(Mult(A, chol.solve(BV)), Matrix<coeff_t>(BV)));
+        REQUIRE(close(Mult(Transpose(A), chol.solve_transposed(BV)),
+                      Matrix<coeff_t>(BV)));
+        REQUIRE(B1 == B);
+        auto c = Random<coeff_t>(n + 4);
+        auto c0 = c;
+        auto cv = c({2, n + 2});
+        REQUIRE(close(Mult(A, chol.solve(cv)), Vector<coeff_t>(cv)));
+        REQUIRE(close(Mult(Transpose(A), chol.solve_transposed(cv)),
+                      Vector<coeff_t>(cv)));
+        REQUIRE(c == c0);
+        chol.solve_inplace(cv);
+        REQUIRE(close(Mult(A, Vector<coeff_t>(cv)),
+                      Vector<coeff_t>(c0({2, n + 2}))));
+        REQUIRE(c(0) == c0(0));
+        REQUIRE(close(Mult(A, chol.inverse()), Id));
+        REQUIRE(std::abs(chol.det() - Determinant(A)) <
+                1e-6 * std::abs(Determinant(A)));
+        REQUIRE(chol.rcond() > 0.);
+        REQUIRE(chol.rcond() <= 1.);
+      }
     }
+
+  // Indefinite matrices are detected
+  auto A = Identity<coeff_t>(n);
+  A(n - 1, n - 1) = -1.;
+  CholeskyFactor<coeff_t> chol(A);
+  REQUIRE(!chol.positive_definite());
 }
 
+template <class coeff_t> void test_cholesky_update() {
+  using namespace lila;
+  int n = 12;
+  int k = 3;
+  uniform_dist_t<coeff_t> fdist(-1., 1.);
+  uniform_gen_t<coeff_t> fgen(fdist, 42);
+  auto B = Random(n, n, fgen);
+  auto A = Mult(B, Herm(B));
+  for (int i = 0; i < n; ++i)
+    A(i, i) += (coeff_t)n;
+  Vector<coeff_t> x(n);
+  Random(x, fgen);
+  auto X = Random(n, k, fgen);
+
+  // A + x x^H and A + X X^H
+  auto Ax = A;
+  auto AX = A;
+  for (int j = 0; j < n; ++j)
+    for (int i = 0; i < n; ++i) {
+      Ax(i, j) += x(i) * conj(x(j));
+      for (int l = 0; l < k; ++l)
+        AX(i, j) += X(i, l) * conj(X(j, l));
+    }
+
+  for (char uplo : {'U', 'L'}) {
+    auto R = Cholesky(A, uplo);
+    CholeskyUpdate(R, x, uplo);
+    REQUIRE(close(R, Cholesky(Ax, uplo)));
+    REQUIRE(CholeskyDowndate(R, x, uplo));
+    REQUIRE(close(R, Cholesky(A, uplo)));
+
+    CholeskyUpdate(R, X, uplo);
+    REQUIRE(close(R, Cholesky(AX, uplo)));
+    REQUIRE(CholeskyDowndate(R, X, uplo));
+    REQUIRE(close(R, Cholesky(A, uplo)));
+
+    // A - y y^H with y = 2 sqrt(A_00) e_0 is indefinite
+    auto y = Zeros<coeff_t>(n);
+    y(0) = 2. * std::sqrt(real(A(0, 0)));
+    REQUIRE(!CholeskyDowndate(R, y, uplo));
+
+    CholeskyFactor<coeff_t> chol(A, uplo);
+    chol.update(X);
+    auto b = Random<coeff_t>(n);
+    REQUIRE(close(Mult(AX, chol.solve(b)), b));
+    REQUIRE(chol.downdate(X));
+    REQUIRE(close(Mult(A, chol.solve(b)), b));
+    REQUIRE(chol.rcond() > 0.);
+    REQUIRE(!chol.downdate(y));
+    REQUIRE(!chol.positive_definite());
+
+    auto Ainv = A;
+    InvertPositiveDefinite(Ainv, uplo);
+    REQUIRE(close(Mult(A, Ainv), Identity<coeff_t>(n)));
+    auto Ainv2 = A;
+    Invert(Ainv2);
+    REQUIRE(close(Ainv, Ainv2));
+  }
+}
 
 TEST_CASE( "cholesky", "[decomp]" ) {
   lila::Log("Test cholesky");
@@ -48,3 +150,12 @@ TEST_CASE( "cholesky", "[decomp]" ) {
   // test_cholesky<std::complex<float>>();
   test_cholesky<std::complex<double>>();
 }
+
+TEST_CASE("cholesky_update", "[decomp]") {
+  lila::Log("Test cholesky_update");
+
+  test_cholesky_update<float>();
+  test_cholesky_update<double>();
+  test_cholesky_update<std::complex<float>>();
+  test_cholesky_update<std::complex<double>>();
+}
@@ -17,9 +17,64 @@ template <class coeff_t> void test_determinant(int m) {
     for (auto eig : eigenvalues)
       prod_eigs *= eig;
     REQUIRE(lila::close(determinant, prod_eigs));
+
+    // Log-determinant and phase from LU
+    auto ld = LogDet(A);
+    REQUIRE(lila::close(ld.second * std::exp(ld.first), Determinant(A)));
+    auto ld_lu = LogDet(lila::LU<coeff_t>(A));
+    REQUIRE(lila::close(ld_lu.first, ld.first));
+    REQUIRE(lila::close(ld_lu.second, ld.second));
+
+    // Cholesky path for positive definite matrices
+    auto P = lila::Gram(A, 'N');
+    for (int i = 0; i < m; ++i)
+      P(i, i) += 1.;
+    auto ld_p = LogDet(P);
+    REQUIRE(ld_p.second == coeff_t(1.));
+    REQUIRE(lila::close(std::exp(ld_p.first), std::abs(Determinant(P))));
+    auto ld_chol = LogDet(lila::CholeskyFactor<coeff_t>(P));
+    REQUIRE(lila::close(ld_chol.first, ld_p.first));
+
+    // Hermitian indefinite matrices fall back to LU
+    auto H = P;
+    H(m - 1, m - 1) = -H(m - 1, m - 1) - coeff_t(100.);
+    auto H_save = H;
+    auto ld_h = LogDetInplace(H);
+    REQUIRE(lila::close(ld_h.second * std::exp(ld_h.first),
+                        Determinant(H_save)));
+    REQUIRE(lila::close(ld_h.second, coeff_t(-1.)));
+    auto ld_ldlt = LogDet(lila::LDLT<coeff_t>(H_save));
+    REQUIRE(lila::close(ld_ldlt.first, ld_h.first));
+    REQUIRE(lila::close(ld_ldlt.second, ld_h.second));
   }
 }
 
+template <class coeff_t> void test_log_det_large() {
+  // det = 10^(-2n) underflows, the log-determinant does not
+  int n = 300;
+  auto A = lila::Identity<coeff_t>(n);
+  for (int i = 0; i < n; ++i)
+    A(i, i) = 0.01;
+
+  // Hermitian positive definite, the Cholesky path overwrites A by its
+  // factor with diagonal 0.1
+  auto P = A;
+  auto ld = LogDetInplace(P);
+  REQUIRE(std::abs(ld.first - n * std::log(0.01)) < 1e-3 * n);
+  REQUIRE(ld.second == coeff_t(1.));
+  REQUIRE(lila::close(P(n - 1, n - 1), coeff_t(0.1)));
+
+  // not Hermitian, by LU
+  A(0, 1) = 0.5;
+  ld = LogDet(A);
+  REQUIRE(std::abs(ld.first - n * std::log(0.01)) < 1e-3 * n);
+  REQUIRE(lila::close(ld.second, coeff_t(1.)));
+  A(0, 0) = -0.01;
+  ld = LogDet(A);
+  REQUIRE(std::abs(ld.first - n * std::log(0.01)) < 1e-3 * n);
+  REQUIRE(lila::close(ld.second, coeff_t(-1.)));
+}
+
 TEST_CASE("determinant", "[decomp]") {
   lila::Log("Test determinant");
 
@@ -29,4 +84,8 @@ TEST_CASE("determinant", "[decomp]") {
     test_determinant<std::complex<float>>(m);
     test_determinant<std::complex<double>>(m);
   }
+  test_log_det_large<float>();
+  test_log_det_large<double>();
+  test_log_det_large<std::complex<float>>();
+  test_log_det_large<std::complex<double>>();
 }
@@ -0,0 +1,96 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t>
+void check_incremental_qr(lila::IncrementalQR<coeff_t> const &qr,
+                          std::vector<lila::Vector<coeff_t>> const &cols) {
+  using namespace lila;
+  lila_size_t m = qr.nrows();
+  lila_size_t k = cols.size();
+  REQUIRE(qr.ncols() == k);
+  Matrix<coeff_t> A(m, k);
+  for (lila_size_t j = 0; j < k; ++j)
+    for (lila_size_t i = 0; i < m; ++i)
+      A(i, j) = cols[j](i);
+  auto Q = qr.Q();
+  auto R = qr.R();
+  REQUIRE(close(Mult(Q, R), A));
+  REQUIRE(close(Mult(Herm(Q), Q), Identity<coeff_t>(k)));
+  for (lila_size_t j = 0; j < k; ++j) {
+    REQUIRE(imag(R(j, j)) == 0.);
+    REQUIRE(real(R(j, j)) > 0.);
+    for (lila_size_t i = j + 1; i < k; ++i)
+      REQUIRE(R(i, j) == coeff_t(0.));
+  }
+
+  // least squares solution and triangular solve
+  if (k > 0) {
+    auto b = Random<coeff_t>(m);
+    auto x = qr.solve(b);
+    auto x0 = LeastSquares(A, b);
+    REQUIRE(close(x, x0));
+    REQUIRE(close(qr.solve_upper(Mult(R, x)), x));
+  }
+}
+
+template <class coeff_t> void test_incremental_qr() {
+  using namespace lila;
+  int m = 40;
+  int max_cols = 12;
+  uniform_dist_t<coeff_t> fdist(-1., 1.);
+  uniform_gen_t<coeff_t> fgen(fdist, 42);
+
+  IncrementalQR<coeff_t> qr(m, max_cols);
+  std::vector<Vector<coeff_t>> cols;
+  check_incremental_qr(qr, cols);
+  for (int j = 0; j < 10; ++j) {
+    Vector<coeff_t> a(m);
+    Random(a, fgen);
+    cols.push_back(a);
+    REQUIRE(qr.append_column(a) > 0.);
+    check_incremental_qr(qr, cols);
+  }
+
+  // a zero column and columns in the span of the current ones are rejected
+  REQUIRE(qr.append_column(Zeros<coeff_t>(m)) == 0.);
+  check_incremental_qr(qr, cols);
+  Vector<coeff_t> dependent(m);
+  for (int i = 0; i < m; ++i)
+    dependent(i) = coeff_t(0.3) * cols[2](i) - coeff_t(1.7) * cols[5](i);
+  REQUIRE(qr.append_column(dependent) == 0.);
+  check_incremental_qr(qr, cols);
+  for (int i = 0; i < m; ++i)
+    for (int j = 0; j < 10; ++j)
+      dependent(i) += coeff_t(0.1 * (j + 1)) * cols[j](i);
+  REQUIRE(qr.append_column(dependent) == 0.);
+  check_incremental_qr(qr, cols);
+
+  // delete in the middle, first and last, then append up to max_cols
+  for (int j : {4, 0, 7}) {
+    qr.delete_column(j);
+    cols.erase(cols.begin() + j);
+    check_incremental_qr(qr, cols);
+  }
+  while ((int)qr.ncols() < max_cols) {
+    Vector<coeff_t> a(m);
+    Random(a, fgen);
+    cols.push_back(a);
+    qr.append_column(a);
+    check_incremental_qr(qr, cols);
+  }
+  while (qr.ncols() > 0) {
+    qr.delete_column(0);
+    cols.erase(cols.begin());
+    check_incremental_qr(qr, cols);
+  }
+}
+
+TEST_CASE("incremental_qr", "[decomp]") {
+  lila::Log("Test incremental_qr");
+
+  test_incremental_qr<float>();
+  test_incremental_qr<double>();
+  test_incremental_qr<std::complex<float>>();
+  test_incremental_qr<std::complex<double>>();
+}
@@ -0,0 +1,79 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_ldlt() {
+  using namespace lila;
+  int n = 20;
+  for (int seed : range<int>(5)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+
+    // Hermitian indefinite matrix
+    auto A = Random(n, n, fgen);
+    Add(Herm(Matrix<coeff_t>(A)), A);
+    auto B = Random(n, 4, fgen);
+    auto b = Random(n, fgen);
+    auto Id = Identity<coeff_t>(n);
+    auto eigs = EigenvaluesSym(A);
+    REQUIRE(eigs(0) < 0.);
+    REQUIRE(eigs(n - 1) > 0.);
+
+    for (char uplo : {'U', 'L'}) {
+      LDLT<coeff_t> ldlt(A, uplo);
+      REQUIRE(!ldlt.singular());
+      REQUIRE(close(Mult(A, ldlt.solve(B)), B));
+      REQUIRE(close(Mult(A, ldlt.solve(b)), b));
+      REQUIRE(close(Mult(Transpose(A), ldlt.solve_transposed(B)), B));
+
+      // views are copied, not overwritten
+      auto B1 = B;
+      auto BV = B1({0, n}, {1, 3});
+      REQUIRE(close(Mult(A, ldlt.solve(BV)), Matrix<coeff_t>(BV)));
+      REQUIRE(close(Mult(Transpose(A), ldlt.solve_transposed(BV)),
+                    Matrix<coeff_t>(BV)));
+      REQUIRE(B1 == B);
+      auto b = Random(n + 4, fgen);
+      auto b0 = b;
+      auto bv = b({2, n + 2});
+      REQUIRE(close(Mult(A, ldlt.solve(bv)), Vector<coeff_t>(bv)));
+      REQUIRE(close(Mult(Transpose(A), ldlt.solve_transposed(bv)),
+                    Vector<coeff_t>(bv)));
+      REQUIRE(b == b0);
+      ldlt.solve_inplace(bv);
+      REQUIRE(close(Mult(A, Vector<coeff_t>(bv)),
+                    Vector<coeff_t>(b0({2, n + 2}))));
+      REQUIRE(b(0) == b0(0));
+      REQUIRE(close(Mult(A, ldlt.inverse()), Id));
+
+      // det A is the product of the eigenvalues
+      real_t<coeff_t> log_det = 0.;
+      real_t<coeff_t> sign = 1.;
+      for (auto e : eigs) {
+        log_det += std::log(std::abs(e));
+        sign *= (e > 0.) ? 1. : -1.;
+      }
+      REQUIRE(ldlt.det_sign() == sign);
+      REQUIRE(std::abs(ldlt.log_det() - log_det) < 1e-3);
+      auto rc = ldlt.rcond();
+      REQUIRE(rc > 0.);
+      REQUIRE(rc <= 1.);
+    }
+  }
+
+  // Singular matrices are detected
+  auto S = Zeros<coeff_t>(n, n);
+  S(0, 0) = 1.;
+  LDLT<coeff_t> ldlt(S);
+  REQUIRE(ldlt.singular());
+  REQUIRE(ldlt.rcond() == 0.);
+}
+
+TEST_CASE("ldlt", "[decomp]") {
+  lila::Log("Test ldlt");
+
+  test_ldlt<float>();
+  test_ldlt<double>();
+  test_ldlt<std::complex<float>>();
+  test_ldlt<std::complex<double>>();
+}
@@ -0,0 +1,122 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+// A^H (A X - B), zero for any least-squares solution X
+template <class coeff_t>
+lila::Matrix<coeff_t> normal_residual(lila::Matrix<coeff_t> const &A,
+                                      lila::Matrix<coeff_t> const &X,
+                                      lila::Matrix<coeff_t> const &B) {
+  auto R = lila::Mult(A, X);
+  R -= B;
+  return lila::Mult(lila::Herm(A), R);
+}
+
+template <class coeff_t> void test_least_squares() {
+  using namespace lila;
+  using real_type = real_t<coeff_t>;
+  auto methods = {LeastSquaresMethod::QR, LeastSquaresMethod::SVD,
+                  LeastSquaresMethod::PivotedQR};
+  uniform_dist_t<coeff_t> fdist(-1., 1.);
+  uniform_gen_t<coeff_t> fgen(fdist, 42);
+  int nrhs = 3;
+
+  // Overdetermined, full rank: all methods give the unique solution
+  {
+    int m = 30;
+    int n = 8;
+    auto A = Random(m, n, fgen);
+    auto B = Random(m, nrhs, fgen);
+    auto X0 = LeastSquares(A, B, LeastSquaresMethod::SVD);
+    REQUIRE(X0.nrows() == n);
+    REQUIRE(X0.ncols() == nrhs);
+    REQUIRE(close(normal_residual(A, X0, B), Zeros<coeff_t>(n, nrhs)));
+    for (auto method : methods) {
+      lila_size_t rank = 0;
+      auto X = LeastSquares(A, B, method, -1., &rank);
+      REQUIRE(rank == n);
+      REQUIRE(close(X, X0));
+    }
+
+    // single right hand side
+    auto b = Random<coeff_t>(m);
+    auto x = LeastSquares(A, b, LeastSquaresMethod::PivotedQR);
+    auto x0 = LeastSquares(A, Matrix<coeff_t>(b));
+    REQUIRE(x.size() == n);
+    for (int i = 0; i < n; ++i)
+      REQUIRE(close(x(i), x0(i, 0)));
+  }
+
+  // Underdetermined, full rank: QR and SVD give the minimum norm solution,
+  // PivotedQR a basic solution with at most m nonzero entries
+  {
+    int m = 8;
+    int n = 20;
+    auto A = Random(m, n, fgen);
+    auto B = Random(m, nrhs, fgen);
+    auto Xqr = LeastSquares(A, B, LeastSquaresMethod::QR);
+    auto Xsvd = LeastSquares(A, B, LeastSquaresMethod::SVD);
+    lila_size_t rank = 0;
+    auto Xp = LeastSquares(A, B, LeastSquaresMethod::PivotedQR, -1., &rank);
+    REQUIRE(rank == m);
+    REQUIRE(close(Xqr, Xsvd));
+    REQUIRE(close(Mult(A, Xsvd), B));
+    REQUIRE(close(Mult(A, Xp), B));
+    real_type tol = 100 * std::numeric_limits<real_type>::epsilon();
+    REQUIRE(Norm(Xsvd) <= Norm(Xp) * (1 + tol));
+    for (int j = 0; j < nrhs; ++j) {
+      int nonzero = 0;
+      for (int i = 0; i < n; ++i)
+        nonzero += (Xp(i, j) != coeff_t(0.));
+      REQUIRE(nonzero <= m);
+    }
+  }
+
+  // Rank deficient: SVD and PivotedQR detect the rank
+  {
+    int m = 30;
+    int n = 10;
+    int r = 6;
+    auto A = Mult(Random(m, r, fgen), Random(r, n, fgen));
+    auto B = Random(m, nrhs, fgen);
+    real_type rcond = 1000 * std::numeric_limits<real_type>::epsilon();
+    for (auto method :
+         {LeastSquaresMethod::SVD, LeastSquaresMethod::PivotedQR}) {
+      lila_size_t rank = 0;
+      auto X = LeastSquares(A, B, method, rcond, &rank);
+      REQUIRE(rank == r);
+      REQUIRE(close(normal_residual(A, X, B), Zeros<coeff_t>(n, nrhs),
+                    real_type(100) * lila::atol<coeff_t>::val()));
+    }
+  }
+
+  // Repeated solves with the same shape reuse the workspace
+  {
+    int m = 25;
+    int n = 12;
+    LeastSquaresWorkspace<coeff_t> ws;
+    for (auto method : methods) {
+      std::vector<lila_size_t> sizes;
+      for (int rep = 0; rep < 3; ++rep) {
+        auto A = Random(m, n, fgen);
+        auto B = Random(m, nrhs, fgen);
+        auto A2 = A;
+        auto X = B;
+        LeastSquaresInplace(A2, X, ws, method);
+        REQUIRE(close(X, LeastSquares(A, B, LeastSquaresMethod::SVD)));
+        sizes.push_back(ws.work.size());
+      }
+      REQUIRE(sizes[1] == sizes[0]);
+      REQUIRE(sizes[2] == sizes[0]);
+    }
+  }
+}
+
+TEST_CASE("least_squares", "[decomp]") {
+  lila::Log("Test least_squares");
+
+  test_least_squares<float>();
+  test_least_squares<double>();
+  test_least_squares<std::complex<float>>();
+  test_least_squares<std::complex<double>>();
+}
@@ -0,0 +1,80 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+// det A2 / det A without overflow
+template <class coeff_t>
+coeff_t det_ratio(lila::Matrix<coeff_t> const &A2,
+                  lila::Matrix<coeff_t> const &A) {
+  auto ld2 = lila::LogDet(A2);
+  auto ld = lila::LogDet(A);
+  return ld2.second / ld.second * std::exp(ld2.first - ld.first);
+}
+
+template <class coeff_t> void test_low_rank_update() {
+  using namespace lila;
+  int n = 30;
+  for (lila_size_t max_delay : {1, 4, 64}) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, (int)max_delay);
+    auto A = Random(n, n, fgen);
+    for (int i = 0; i < n; ++i)
+      A(i, i) += (coeff_t)n;
+    LowRankUpdater<coeff_t> upd(A, max_delay);
+
+    for (int step = 0; step < 20; ++step) {
+      auto u = Random(n, fgen);
+      u(step) += (coeff_t)n;
+      auto A2 = A;
+      if (step % 2 == 0) {
+        // replace a row
+        int r = step;
+        for (int j = 0; j < n; ++j)
+          A2(r, j) = u(j);
+        auto ratio = upd.ratio_row(r, u);
+        REQUIRE(close(ratio, det_ratio(A2, A)));
+        REQUIRE(close(upd.accept_row(r, u), ratio));
+      } else {
+        // replace a column
+        int c = step;
+        for (int i = 0; i < n; ++i)
+          A2(i, c) = u(i);
+        auto ratio = upd.ratio_column(c, u);
+        REQUIRE(close(ratio, det_ratio(A2, A)));
+        REQUIRE(close(upd.accept_column(c, u), ratio));
+      }
+      A = A2;
+      REQUIRE(upd.pending() < max_delay);
+    }
+    REQUIRE(close(Mult(A, upd.inverse()), Identity<coeff_t>(n)));
+    REQUIRE(upd.pending() == 0);
+
+    // Rank-k update with pending rank-1 updates
+    auto u = Random(n, fgen);
+    u(0) += (coeff_t)n;
+    upd.accept_row(0, u);
+    for (int j = 0; j < n; ++j)
+      A(0, j) = u(j);
+    auto X = Random(n, 3, fgen);
+    auto Y = Random(n, 3, fgen);
+    auto A2 = A;
+    Mult(X, Transpose(Y), A2, coeff_t(1.), coeff_t(1.));
+    auto ratio = upd.ratio(X, Y);
+    REQUIRE(close(ratio, det_ratio(A2, A)));
+    REQUIRE(close(upd.accept(X, Y), ratio));
+    REQUIRE(close(Mult(A2, upd.inverse()), Identity<coeff_t>(n)));
+
+    // Reset from scratch
+    upd.reset(A2);
+    REQUIRE(close(Mult(A2, upd.inverse()), Identity<coeff_t>(n)));
+  }
+}
+
+TEST_CASE("low_rank_update", "[decomp]") {
+  lila::Log("Test low_rank_update");
+
+  test_low_rank_update<float>();
+  test_low_rank_update<double>();
+  test_low_rank_update<std::complex<float>>();
+  test_low_rank_update<std::complex<double>>();
+}
@@ -0,0 +1,84 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_lu() {
+  using namespace lila;
+  int n = 20;
+  for (int seed : range<int>(5)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+    auto A = Random(n, n, fgen);
+    auto B = Random(n, 4, fgen);
+    auto b = Random(n, fgen);
+    auto Id = Identity<coeff_t>(n);
+
+    LU<coeff_t> lu(A);
+    REQUIRE(!lu.singular());
+    REQUIRE(close(Mult(A, lu.solve(B)), B));
+    REQUIRE(close(Mult(A, lu.solve(b)), b));
+    REQUIRE(close(Mult(Transpose(A), lu.solve_transposed(B)), B));
+    REQUIRE(close(Mult(Herm(A), lu.solve_adjoint(B)), B));
+    REQUIRE(close(Mult(A, lu.inverse()), Id));
+
+    // Solving in place on a view of a larger matrix
+    auto C = Random(n, 6, fgen);
+    auto C0 = C;
+    lu.solve_inplace(C({0, n}, {2, 5}));
+    auto X = Matrix<coeff_t>(C({0, n}, {2, 5}));
+    REQUIRE(close(Mult(A, X), Matrix<coeff_t>(C0({0, n}, {2, 5}))));
+    REQUIRE(close(Matrix<coeff_t>(C({0, n}, {0, 2})),
+                  Matrix<coeff_t>(C0({0, n}, {0, 2}))));
+
+    // Solving for a view returns a copy and leaves the view unchanged
+    auto C2 = C0;
+    auto CV = C0({0, n}, {2, 5});
+    auto XV = lu.solve(CV);
+    REQUIRE(close(Mult(A, XV), Matrix<coeff_t>(CV)));
+    REQUIRE(close(Mult(Transpose(A), lu.solve_transposed(CV)),
+                  Matrix<coeff_t>(CV)));
+    lu.solve_adjoint(CV);
+    REQUIRE(C0 == C2);
+
+    // Contiguous part of a vector as right-hand side
+    auto c = Random(n + 4, fgen);
+    auto c0 = c;
+    auto cv = c({2, n + 2});
+    REQUIRE(close(Mult(A, lu.solve(cv)), Vector<coeff_t>(cv)));
+    REQUIRE(c == c0);
+    lu.solve_inplace(cv);
+    REQUIRE(close(Mult(A, Vector<coeff_t>(cv)),
+                  Vector<coeff_t>(c0({2, n + 2}))));
+    REQUIRE(c(0) == c0(0));
+    REQUIRE(c(n + 3) == c0(n + 3));
+
+    // Determinant, log-determinant and condition number
+    auto det = Determinant(A);
+    REQUIRE(close(lu.det(), det));
+    REQUIRE(std::abs(lu.log_det() - std::log(std::abs(det))) < 1e-3);
+    auto rc = lu.rcond();
+    REQUIRE(rc > 0.);
+    REQUIRE(rc <= 1.);
+
+    // Factoring from an rvalue
+    auto A2 = A;
+    LU<coeff_t> lu2(std::move(A2));
+    REQUIRE(close(lu2.solve(B), lu.solve(B)));
+  }
+
+  // Singular matrices are detected
+  auto S = Zeros<coeff_t>(n, n);
+  S(0, 0) = 1.;
+  LU<coeff_t> lu(S);
+  REQUIRE(lu.singular());
+  REQUIRE(lu.rcond() == 0.);
+}
+
+TEST_CASE("lu", "[decomp]") {
+  lila::Log("Test lu");
+
+  test_lu<float>();
+  test_lu<double>();
+  test_lu<std::complex<float>>();
+  test_lu<std::complex<double>>();
+}
@@ -0,0 +1,69 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_pfaffian() {
+  using namespace lila;
+  for (int n : {0, 2, 4, 10, 41, 70}) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, n);
+
+    // Pf(B J B^T) = det(B) for the standard symplectic J
+    auto J = Zeros<coeff_t>(n, n);
+    for (int i = 0; i + 1 < n; i += 2) {
+      J(i, i + 1) = 1.;
+      J(i + 1, i) = -1.;
+    }
+    auto B = Random(n, n, fgen);
+    auto A = Mult(Mult(B, J), Transpose(B));
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < i; ++j)
+        A(i, j) = -A(j, i);
+    for (int i = 0; i < n; ++i)
+      A(i, i) = 0.;
+
+    if (n % 2 == 1) {
+      REQUIRE(Pfaffian(A) == coeff_t(0.));
+      continue;
+    }
+    auto ld = LogDet(B);
+    for (lila_size_t block_size : {1, 3, 32}) {
+      auto lp = LogPfaffian(A, block_size);
+      REQUIRE(std::abs(lp.first - ld.first) <
+              1e-3 * (1. + std::abs(ld.first)));
+      REQUIRE(close(lp.second, ld.second));
+    }
+    if (n != 10)
+      continue;
+
+    REQUIRE(close(Pfaffian(A), Determinant(B)));
+
+    // Rank-2 updates of the inverse
+    auto G = A;
+    Invert(G);
+    for (int step = 0; step < 5; ++step) {
+      auto u = Random(n, fgen);
+      auto v = Random(n, fgen);
+      auto A2 = A;
+      for (int i = 0; i < n; ++i)
+        for (int j = 0; j < n; ++j)
+          A2(i, j) += u(i) * v(j) - v(i) * u(j);
+      auto lp = LogPfaffian(A);
+      auto lp2 = LogPfaffian(A2);
+      auto ratio = lp2.second / lp.second * std::exp(lp2.first - lp.first);
+      REQUIRE(close(PfaffianRatio(G, u, v), ratio));
+      REQUIRE(close(PfaffianUpdate(G, u, v), ratio));
+      REQUIRE(close(Mult(A2, G), Identity<coeff_t>(n)));
+      A = A2;
+    }
+  }
+}
+
+TEST_CASE("pfaffian", "[decomp]") {
+  lila::Log("Test pfaffian");
+
+  test_pfaffian<float>();
+  test_pfaffian<double>();
+  test_pfaffian<std::complex<float>>();
+  test_pfaffian<std::complex<double>>();
+}
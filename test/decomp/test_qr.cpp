@@ -55,6 +55,40 @@ void test_qr(int m, int n)
   
 }
 
+template <class coeff_t> void test_qr_apply(int m, int n) {
+  using namespace lila;
+  int k = std::min(m, n);
+  int p = 4;
+  uniform_dist_t<coeff_t> fdist(-1., 1.);
+  uniform_gen_t<coeff_t> fgen(fdist, m + n);
+  auto A = Random(m, n, fgen);
+  auto tau = QRDecompose(A);
+  auto Q = QRGetQ(A, tau);
+
+  // Q^H X, its first k rows are Q_k^H X
+  auto X = Random(m, p, fgen);
+  auto Y = X;
+  QRApplyQ(A, tau, Y, 'L', 'C');
+  auto QhX = Mult(Herm(Q), X);
+  REQUIRE(close(Matrix<coeff_t>(Y({0, k}, {0, p})), QhX));
+  QRApplyQ(A, tau, Y, 'L', 'N');
+  REQUIRE(close(Y, X));
+
+  // Q [C; 0] = Q_k C
+  auto C = Random(k, p, fgen);
+  auto Z = C;
+  Z.resize(m, p);
+  QRApplyQ(A, tau, Z);
+  REQUIRE(close(Z, Mult(Q, C)));
+
+  // X Q, its first k columns are X Q_k
+  auto W = Random(p, m, fgen);
+  auto V = W;
+  QRApplyQ(A, tau, V, 'R', 'N');
+  REQUIRE(close(Matrix<coeff_t>(V({0, p}, {0, k})), Mult(W, Q)));
+  QRApplyQ(A, tau, V, 'R', 'C');
+  REQUIRE(close(V, W));
+}
 
 TEST_CASE( "qr", "[decomp]" ) {
   lila::Log("Test qr");
@@ -71,4 +105,11 @@ TEST_CASE( "qr", "[decomp]" ) {
   test_qr<double>(5,6);
   test_qr<std::complex<float>>(5,6);
   test_qr<std::complex<double>>(5,6);
+
+  for (auto mn : {std::pair<int, int>{30, 8}, {12, 12}, {8, 20}}) {
+    test_qr_apply<float>(mn.first, mn.second);
+    test_qr_apply<double>(mn.first, mn.second);
+    test_qr_apply<std::complex<float>>(mn.first, mn.second);
+    test_qr_apply<std::complex<double>>(mn.first, mn.second);
+  }
 }
@@ -72,8 +72,57 @@ void test_solve()
     Zeros(Prod);
     Mult(A, A_inv, Prod);
     REQUIRE(lila::close<coeff_t>(Id, Prod));
+
+    // Triangular solves with a well conditioned triangle of A
+    for (int i = 0; i < n; ++i)
+      A(i, i) += (coeff_t)(2. * n);
+    auto U = A;
+    for (int j = 0; j < n; ++j)
+      for (int i = j + 1; i < n; ++i)
+        U(i, j) = 0.;
+    auto Bt = lila::Herm(B);
+    REQUIRE(lila::close(lila::Mult(U, lila::SolveTri(A, B)), B));
+    REQUIRE(lila::close(lila::Mult(lila::SolveTri(A, Bt, 'R'), U), Bt));
+    REQUIRE(lila::close(
+        lila::Mult(lila::Herm(U), lila::SolveTri(A, B, 'L', 'U', 'C')), B));
+    REQUIRE(lila::close(lila::Mult(U, lila::SolveTri(A, b)), b));
+    auto Y = lila::MultTri(A, B);
+    lila::SolveTriInplace(A, Y);
+    REQUIRE(lila::close(Y, B));
+
+    // Mixed precision solve with iterative refinement
+    lila::blas_size_t iter = -1;
+    auto Xm = lila::SolveMixed(A_save, B, &iter);
+    REQUIRE(iter >= 0);
+    REQUIRE(lila::close(lila::Mult(A_save, Xm), B));
+    auto xm = lila::SolveMixed(A_save, b, &iter);
+    REQUIRE(iter >= 0);
+    REQUIRE(lila::close(lila::Mult(A_save, xm), b));
+    if (std::is_same<lila::real_t<coeff_t>, double>::value) {
+      auto R = B;
+      lila::Mult(A_save, Xm, R, coeff_t(-1.), coeff_t(1.));
+      REQUIRE(lila::NormLi(R) < 1e-12 * lila::NormLi(B));
+    }
+  }
+
+  // Ill-conditioned systems fall back to a full precision LU
+  if (std::is_same<lila::real_t<coeff_t>, double>::value) {
+    int m = 12;
+    lila::Matrix<coeff_t> H(m, m);
+    for (int i = 0; i < m; ++i)
+      for (int j = 0; j < m; ++j)
+        H(i, j) = 1. / (i + j + 1.);
+    lila::Vector<coeff_t> h(m);
+    for (int i = 0; i < m; ++i)
+      h(i) = 1.;
+    lila::blas_size_t iter = 0;
+    auto x = lila::SolveMixed(H, h, &iter);
+    REQUIRE(iter < 0);
+    auto x2 = h;
+    auto H2 = H;
+    Solve(H2, x2);
+    REQUIRE(lila::close(x, x2));
   }
-  
 }
 
 
@@ -0,0 +1,123 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t>
+lila::Matrix<coeff_t> svd_product(lila::Matrix<coeff_t> const &U,
+                                  lila::Vector<lila::real_t<coeff_t>> const &s,
+                                  lila::Matrix<coeff_t> const &Vh) {
+  auto US = U;
+  for (lila::lila_size_t j = 0; j < s.size(); ++j)
+    for (lila::lila_size_t i = 0; i < U.nrows(); ++i)
+      US(i, j) *= s(j);
+  US.resize(U.nrows(), Vh.nrows());
+  return lila::Mult(US, Vh);
+}
+
+template <class coeff_t> void test_svd() {
+  using namespace lila;
+  for (auto mn : {std::pair<int, int>{20, 20}, {30, 12}, {12, 30}}) {
+    int m = mn.first;
+    int n = mn.second;
+    int k = std::min(m, n);
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, m + n);
+    auto A = Random(m, n, fgen);
+
+    // Economy and full SVD, both methods
+    for (auto method : {SVDMethod::DivideAndConquer, SVDMethod::QRIteration}) {
+      for (bool economy : {true, false}) {
+        auto [U, s, Vh] = SVD(A, economy, method);
+        REQUIRE(U.nrows() == m);
+        REQUIRE(U.ncols() == (economy ? k : m));
+        REQUIRE(Vh.nrows() == (economy ? k : n));
+        REQUIRE(s.size() == k);
+        REQUIRE(close(svd_product(U, s, Vh), A));
+        REQUIRE(close(Mult(Herm(U), U), Identity<coeff_t>(U.ncols())));
+        REQUIRE(close(Mult(Vh, Herm(Vh)), Identity<coeff_t>(Vh.nrows())));
+        for (int i = 1; i < k; ++i)
+          REQUIRE(s(i - 1) >= s(i));
+      }
+    }
+
+    // Singular values agree with the eigenvalues of A^H A
+    auto s = SingularValues(A);
+    auto e = EigenvaluesSym(Mult(Herm(A), A));
+    for (int i = 0; i < k; ++i)
+      REQUIRE(close(s(i) * s(i), e(n - 1 - i)));
+
+    // Workspace reuse for matrices of equal shape
+    Matrix<coeff_t> U, Vh;
+    Vector<real_t<coeff_t>> s2;
+    SVDWorkspace<coeff_t> ws;
+    for (int rep = 0; rep < 3; ++rep) {
+      auto B = Random(m, n, fgen);
+      auto B_save = B;
+      SVDInplace(B, U, s2, Vh, ws);
+      REQUIRE(close(svd_product(U, s2, Vh), B_save));
+    }
+
+    // Truncation of a matrix with decaying singular values
+    auto [U0, s0, Vh0] = SVD(A);
+    for (int i = 0; i < k; ++i)
+      s0(i) = std::pow(0.1, i);
+    auto C = svd_product(U0, s0, Vh0);
+    real_t<coeff_t> discarded = 0.;
+    auto [Ut, st, Vht] = TruncatedSVD(C, 5, real_t<coeff_t>(0.), &discarded);
+    REQUIRE(st.size() == 5);
+    REQUIRE(Ut.ncols() == 5);
+    REQUIRE(Vht.nrows() == 5);
+    REQUIRE(discarded > 0.);
+    REQUIRE(discarded < 1e-9);
+    auto [Uc, sc, Vhc] = TruncatedSVD(C, k, real_t<coeff_t>(1e-5));
+    REQUIRE(sc.size() == 3);
+    auto [Uq, sq, Vhq] = TruncatedSVD(C, 5, real_t<coeff_t>(0.), nullptr,
+                                      SVDMethod::QRIteration);
+    REQUIRE(close(svd_product(Uq, sq, Vhq), svd_product(Ut, st, Vht)));
+
+    // Repeated truncation keeps the storage of U and Vh
+    Matrix<coeff_t> Ur2, Vhr2;
+    Vector<real_t<coeff_t>> sr2;
+    SVDWorkspace<coeff_t> tws;
+    coeff_t const *pu = nullptr;
+    coeff_t const *pvh = nullptr;
+    for (int rep = 0; rep < 3; ++rep) {
+      auto B = C;
+      TruncatedSVDInplace(B, Ur2, sr2, Vhr2, tws, 5);
+      REQUIRE(close(svd_product(Ur2, sr2, Vhr2), svd_product(Ut, st, Vht)));
+      if (rep > 0) {
+        REQUIRE(Ur2.data() == pu);
+        REQUIRE(Vhr2.data() == pvh);
+      }
+      pu = Ur2.data();
+      pvh = Vhr2.data();
+    }
+
+    // Randomized SVD recovers the dominant part
+    auto [Ur, sr, Vhr] = RandomizedSVD(C, 4);
+    REQUIRE(sr.size() == 4);
+    for (int i = 0; i < 4; ++i)
+      REQUIRE(std::abs(sr(i) - s0(i)) < 1e-3 * s0(i));
+    REQUIRE(close(Mult(Herm(Ur), Ur), Identity<coeff_t>(4)));
+    REQUIRE(close(svd_product(Ur, sr, Vhr), svd_product(Ut, st, Vht), 1e-3));
+
+    // Repeated calls reuse the buffers in the workspace
+    normal_dist_t<coeff_t> dist(0., 1.);
+    normal_gen_t<coeff_t> gen(dist, 1);
+    SVDWorkspace<coeff_t> rws;
+    for (int rep = 0; rep < 2; ++rep) {
+      RandomizedSVDInplace(C, U, s2, Vh, rws, 4, gen);
+      REQUIRE(s2.size() == 4);
+      REQUIRE(close(svd_product(U, s2, Vh), svd_product(Ut, st, Vht), 1e-3));
+    }
+  }
+}
+
+TEST_CASE("svd", "[decomp]") {
+  lila::Log("Test svd");
+
+  test_svd<float>();
+  test_svd<double>();
+  test_svd<std::complex<float>>();
+  test_svd<std::complex<double>>();
+}
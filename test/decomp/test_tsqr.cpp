@@ -0,0 +1,50 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_tsqr() {
+  using namespace lila;
+  // chunk sizes giving a single chunk, an even and an odd number of chunks
+  // and a chunk size below k
+  for (auto mk : {std::pair<int, int>{40, 8}, {500, 12}, {700, 5}}) {
+    int m = mk.first;
+    int k = mk.second;
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, m + k);
+    auto A = Random(m, k, fgen);
+
+    for (lila_size_t chunk_rows : {0, 100, 60, 3}) {
+      TSQR<coeff_t> qr(A, chunk_rows);
+      auto Q = qr.Q();
+      auto const &R = qr.R();
+      REQUIRE(Q.nrows() == m);
+      REQUIRE(Q.ncols() == k);
+      REQUIRE(close(Mult(Q, R), A));
+      REQUIRE(close(Mult(Herm(Q), Q), Identity<coeff_t>(k)));
+      for (int j = 0; j < k; ++j)
+        for (int i = j + 1; i < k; ++i)
+          REQUIRE(R(i, j) == coeff_t(0.));
+
+      // Q^H A = R, Q^H Q C = C
+      REQUIRE(close(qr.apply_qh(A), R));
+      auto C = Random(k, 3, fgen);
+      REQUIRE(close(qr.apply_qh(qr.apply_q(C)), C));
+
+      auto [Q2, R2] = CholeskyQR2(A, chunk_rows);
+      REQUIRE(close(Mult(Q2, R2), A));
+      REQUIRE(close(Mult(Herm(Q2), Q2), Identity<coeff_t>(k)));
+      for (int j = 0; j < k; ++j)
+        for (int i = j + 1; i < k; ++i)
+          REQUIRE(R2(i, j) == coeff_t(0.));
+    }
+  }
+}
+
+TEST_CASE("tsqr", "[decomp]") {
+  lila::Log("Test tsqr");
+
+  test_tsqr<float>();
+  test_tsqr<double>();
+  test_tsqr<std::complex<float>>();
+  test_tsqr<std::complex<double>>();
+}
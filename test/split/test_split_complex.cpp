@@ -0,0 +1,84 @@
+#include "../catch.hpp"
+
+#include <lila/all.h>
+
+template <class coeff_t> void test_split_complex() {
+  using namespace lila;
+  int m = 7;
+  int n = 11;
+
+  for (int seed : range<int>(5)) {
+    uniform_dist_t<coeff_t> fdist(-1., 1.);
+    uniform_gen_t<coeff_t> fgen(fdist, seed);
+
+    // Conversion round trip
+    auto v = Random(n, fgen);
+    auto w = Random(n, fgen);
+    auto sv = Split(v);
+    auto sw = Split(w);
+    for (int i = 0; i < n; ++i)
+      REQUIRE(sv(i) == v(i));
+    REQUIRE(Interleave(sv) == v);
+
+    // BLAS-1 kernels
+    REQUIRE(close(Dot(sv, sw), Dot(v, w)));
+    REQUIRE(close(Norm(sv), Norm(v)));
+
+    coeff_t alpha(0.3, -1.2);
+    auto u = w;
+    Add(v, u, alpha);
+    auto su = sw;
+    Add(sv, su, alpha);
+    REQUIRE(close(Interleave(su), u));
+
+    Scale(alpha, u);
+    Scale(alpha, su);
+    REQUIRE(close(Interleave(su), u));
+
+    // Element-wise kernels
+    SplitVector<coeff_t> sprod;
+    HadamardMult(sv, sw, sprod);
+    auto conj = Conj(sv);
+    for (int i = 0; i < n; ++i) {
+      REQUIRE(close(sprod(i), v(i) * w(i)));
+      REQUIRE(conj(i) == lila::conj(v(i)));
+    }
+
+    Map(sv, [](real_t<coeff_t> &re, real_t<coeff_t> &im) {
+      re = 2 * re;
+      im = -im;
+    });
+    for (int i = 0; i < n; ++i)
+      REQUIRE(close(sv(i), coeff_t(2 * v(i).real(), -v(i).imag())));
+
+    // Matrices
+    auto A = Random(m, n, fgen);
+    auto B = Random(m, n, fgen);
+    auto sA = Split(A);
+    auto sB = Split(B);
+    REQUIRE(Interleave(sA) == A);
+    REQUIRE(close(Norm(sA), Norm(A)));
+
+    auto C = B;
+    Add(A, C, alpha);
+    auto sC = sB;
+    Add(sA, sC, alpha);
+    REQUIRE(close(Interleave(sC), C));
+
+    SplitMatrix<coeff_t> sD;
+    HadamardMult(sA, sB, sD);
+    auto sAc = Conj(sA);
+    for (int i = 0; i < m; ++i)
+      for (int j = 0; j < n; ++j) {
+        REQUIRE(close(sD(i, j), A(i, j) * B(i, j)));
+        REQUIRE(sAc(i, j) == lila::conj(A(i, j)));
+      }
+  }
+}
+
+TEST_CASE("split_complex", "[split]") {
+  lila::Log("Test split_complex");
+
+  test_split_complex<std::complex<float>>();
+  test_split_complex<std::complex<double>>();
+}
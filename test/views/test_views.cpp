@@ -102,9 +102,57 @@ template <class coeff_t> void test_views() {
 
 }
 
+template <class coeff_t> void test_real_imag_views() {
+  using real_type = real_t<coeff_t>;
+  int m = 5;
+  int n = 7;
+
+  // Vector parts share storage with the complex vector
+  auto vec = Random<coeff_t>(n);
+  auto re = RealView(vec);
+  auto im = ImagView(vec);
+  REQUIRE(re.n() == n);
+  REQUIRE(re.inc() == 2);
+  REQUIRE(vec.use_count() == 3);
+  REQUIRE(Vector<real_type>(re) == Real(vec));
+  REQUIRE(Vector<real_type>(im) == Imag(vec));
+  REQUIRE(close(Norm(re), Norm(Real(vec))));
+  REQUIRE(close(Dot(re, im), Dot(Real(vec), Imag(vec))));
+
+  auto vec2 = vec;
+  im *= (real_type)-1.;
+  for (int i = 0; i < n; ++i)
+    REQUIRE(vec(i) == lila::conj(vec2(i)));
+
+  // Views of strided vector views
+  auto sub_re = RealView(vec({1, n, 2}));
+  for (int i = 0; i < sub_re.n(); ++i)
+    REQUIRE(sub_re.data()[i * sub_re.inc()] == lila::real(vec(1 + 2 * i)));
+
+  // Matrix and submatrix parts
+  auto mat = Random<coeff_t>(m, n);
+  auto mat2 = mat;
+  REQUIRE(Matrix<real_type>(RealView(mat)) == Real(mat));
+  REQUIRE(Matrix<real_type>(ImagView(mat)) == Imag(mat));
+  RealView(mat({1, 4}, {2, 6})) = (real_type)0.;
+  for (int i = 0; i < m; ++i)
+    for (int j = 0; j < n; ++j) {
+      bool inside = (1 <= i) && (i < 4) && (2 <= j) && (j < 6);
+      REQUIRE(lila::real(mat(i, j)) == (inside ? 0 : lila::real(mat2(i, j))));
+      REQUIRE(lila::imag(mat(i, j)) == lila::imag(mat2(i, j)));
+    }
+
+  // Complex from real copies into the real part
+  auto rmat = Real(mat2);
+  REQUIRE(Real(Complex(rmat)) == rmat);
+  REQUIRE(close(Norm(Imag(Complex(rmat))), (real_type)0.));
+}
+
 TEST_CASE("views", "[core]") {
   test_views<float>();
   test_views<double>();
   test_views<std::complex<float>>();
   test_views<std::complex<double>>();
+  test_real_imag_views<std::complex<float>>();
+  test_real_imag_views<std::complex<double>>();
 }